@@ -20,6 +20,7 @@
 //
 // -- Include standard libraries
 //    --------------------------
+#include <cstdint>
 #include <string>
 #include <string_view>
 #include <iostream>
@@ -29,8 +30,12 @@
 #include <vector>
 #include <cassert>
 #include <unordered_map>
+#include <deque>
 #include <memory>
 #include <variant>
+#include <mutex>
+#include <thread>
+#include <chrono>
 
 
 
@@ -38,11 +43,12 @@
 //
 // -- Inlcude the tokens and then clean up some types
 //    -----------------------------------------------
+#include "atoms.hh"
+#include "universal.hh"
 #include "tokens.hh"
-extern YYSTYPE yylval;
+#include "keywords.hh"
 
 
-class ASTNode;
 class SymbolVisitor;
 class Symbol;
 class TypeSymbol;
@@ -60,6 +66,7 @@ class AttributeSymbol;
 class ObjectSymbol;
 class ComponentSymbol;
 class IncompleteTypeSymbol;
+class Journal;
 
 
 
@@ -68,12 +75,20 @@ class IncompleteTypeSymbol;
 // -- Include the other headers
 //    -------------------------
 #include "options.hh"
+#include "source.hh"
+#include "lexer.hh"
 #include "tstream.hh"
+#include "token-cache.hh"
+#include "productions.hh"
+#include "first-sets.hh"
+#include "ast.hh"
 #include "diag.hh"
 #include "visitors.hh"
 #include "symbol.hh"
 #include "scope.hh"
 #include "scope-manager.hh"
+#include "profile.hh"
+#include "journal.hh"
 #include "parser.hh"
 
 
@@ -81,8 +96,6 @@ class IncompleteTypeSymbol;
 //
 // -- some global variables
 //    ---------------------
-extern std::string strVal;
-extern int column;
 extern TokenStream *tokens;
 
 
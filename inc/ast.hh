@@ -0,0 +1,154 @@
+//=================================================================================================================
+//  ast.hh -- This header defines the abstract syntax tree built by the parser
+//
+//        Copyright (c)  2025-2026 -- Adam Clark; See LICENSE.md
+//
+//  The tree is kept in one arena per compilation: a vector of fixed-size nodes which refer to one another
+//  by 32-bit index rather than by pointer.  Nodes are only ever added at the end, so a checkpoint is the
+//  size of the arena and rolling back to it (when a `MarkStream` gives up on an alternative) drops every
+//  node built since in one step.
+//
+//  The parser builds the tree bottom up.  Each finished subtree is left on a `pending` list until the
+//  production around it finishes, when the subtrees it left become the children of its own node.  A
+//  production which only passes along a single subtree over exactly the same tokens (`type_mark` or
+//  `relation` with no operator) does not get a node of its own.  The operators in an expression are
+//  built as `Unary`, `Binary` and `Membership` nodes by the expression loop, and the tokens which carry
+//  a value are leaves.
+//
+// ---------------------------------------------------------------------------------------------------------------
+//
+//     Date      Tracker  Version  Pgmr  Description
+//  -----------  -------  -------  ----  -------------------------------------------------------------------------
+//  2026-Oct-17  Initial   0.0.0   ADCL  Initial version
+//
+//=================================================================================================================
+
+
+
+//
+// -- The kinds of node in the tree
+//    -----------------------------
+enum class NodeKind : uint8_t {
+    None,                   // -- node 0, which is no node at all
+    Production,             // -- `prod` names the production; the children are its parts
+    Identifier,             // -- `value` is the atom
+    CharacterLiteral,       // -- `value` is the character
+    IntegerLiteral,         // -- `value` is the index into the integers of the `LiteralPool`
+    RealLiteral,            // -- `value` is the index into the reals of the `LiteralPool`
+    StringLiteral,          // -- `value` is the index into the strings of the tree
+    Null,                   // -- the literal `null`
+    Keyword,                // -- a reserved word which changes the meaning of its parent; `op` is the word
+    Unary,                  // -- `op` applied to the one child
+    Binary,                 // -- `op` applied to the two children
+    Membership,             // -- `op` is TOK_IN or TOK_NOT (for `not in`); the value and the range or type mark
+};
+
+
+
+//
+// -- A node is referred to by its index in the arena; 0 is no node
+//    -------------------------------------------------------------
+using NodeRef_t = uint32_t;
+constexpr NodeRef_t NoNode = 0;
+
+
+
+//
+// -- A node of the tree.  The children of a node are a list, linked through `next`.
+//    ------------------------------------------------------------------------------
+using ASTNode_t = struct ASTNode_t {
+    NodeKind kind;
+    ProdID prod;
+    TokenType op;
+    SourceLoc_t loc;
+    NodeRef_t child;
+    NodeRef_t next;
+    uint32_t value;
+};
+
+static_assert(sizeof(ASTNode_t) == 20, "AST nodes are expected to be 20 bytes");
+
+
+
+//
+// -- The tree for one compilation
+//    ----------------------------
+class AST {
+    AST(const AST &) = delete;
+    AST &operator=(const AST &) = delete;
+
+
+public:
+    using Checkpoint_t = struct Checkpoint_t {
+        uint32_t nodes;
+        uint32_t pending;
+        uint32_t strings;
+    };
+
+
+private:
+    // -- a finished subtree waiting for its parent, with the tokens it covers
+    using Pending_t = struct Pending_t {
+        NodeRef_t node;
+        int from;
+        int to;
+    };
+
+
+public:
+    //
+    // -- The subtrees built since a checkpoint, kept so they can be built again elsewhere in the arena
+    //    ---------------------------------------------------------------------------------------------
+    using Fragment_t = struct Fragment_t {
+        uint32_t base;
+        uint32_t stringBase;
+        std::vector<ASTNode_t> nodes;
+        std::vector<StringLiteral> strings;
+        std::vector<Pending_t> pending;
+    };
+
+
+private:
+    std::vector<ASTNode_t> nodes;
+    std::vector<Pending_t> pending;
+    std::vector<StringLiteral> strings;
+
+
+private:
+    NodeRef_t Add(const ASTNode_t &n) { nodes.push_back(n); return (NodeRef_t)(nodes.size() - 1); }
+
+
+public:
+    AST(void) { nodes.reserve(1 << 16); nodes.push_back(ASTNode_t {}); }
+
+
+public:
+    Checkpoint_t Checkpoint(void) const {
+        return Checkpoint_t { (uint32_t)nodes.size(), (uint32_t)pending.size(), (uint32_t)strings.size() };
+    }
+    void Rollback(const Checkpoint_t &cp) {
+        nodes.resize(cp.nodes);
+        pending.resize(cp.pending);
+        strings.resize(cp.strings);
+    }
+    size_t Pending(void) const { return pending.size(); }
+    NodeRef_t Last(void) const { return pending.empty() ? NoNode : pending.back().node; }
+    int From(size_t idx) const { return pending[idx].from; }
+    size_t Size(void) const { return nodes.size() - 1; }
+    const ASTNode_t &Node(NodeRef_t n) const { return nodes[n]; }
+    uint32_t AddString(const StringLiteral &s) { strings.push_back(s); return (uint32_t)(strings.size() - 1); }
+    const StringLiteral &String(uint32_t idx) const { return strings[idx]; }
+
+
+public:
+    NodeRef_t Leaf(NodeKind kind, TokenType op, SourceLoc_t loc, uint32_t value, int from, int to);
+    NodeRef_t Reduce(NodeKind kind, TokenType op, SourceLoc_t loc, size_t first, int from, int to);
+    NodeRef_t Wrap(ProdID prod, SourceLoc_t loc, size_t first, int from, int to);
+    void Close(ProdID prod, SourceLoc_t loc, const Checkpoint_t &cp, int from, int to, bool keep, bool lift);
+    void Graft(size_t first);
+    bool Since(const Checkpoint_t &cp, Fragment_t &frag) const;
+    void Replay(const Fragment_t &frag);
+    void Print(void) const;
+};
+
+
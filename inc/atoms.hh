@@ -0,0 +1,58 @@
+//=================================================================================================================
+//  atoms.hh -- This header defines the identifier interner
+//
+//        Copyright (c)  2025-2026 -- Adam Clark; See LICENSE.md
+//
+//  Every identifier spelling is case-folded and interned exactly once, by the scanner.  From that point
+//  forward, the identifier is carried as a 32-bit atom through the token payloads, the parser and the
+//  symbol tables.  Comparing 2 names is comparing 2 integers; the spelling is only needed again when a
+//  name is printed.
+//
+// ---------------------------------------------------------------------------------------------------------------
+//
+//     Date      Tracker  Version  Pgmr  Description
+//  -----------  -------  -------  ----  -------------------------------------------------------------------------
+//  2026-Oct-17  Initial   0.0.0   ADCL  Initial version
+//
+//=================================================================================================================
+
+
+
+//
+// -- An atom is the handle to an interned spelling; atom 0 is always the empty spelling
+//    ----------------------------------------------------------------------------------
+using Atom_t = uint32_t;
+constexpr Atom_t NoAtom = 0;
+
+
+
+//
+// -- This is the interner, which maps spellings to atoms and back.  Scanners on several threads share
+//    the one interner, so every access takes the lock.
+//    -------------------------------------------------------------------------------------------------
+class Interner {
+    Interner(const Interner &) = delete;
+    Interner &operator=(const Interner &) = delete;
+
+
+private:
+    // -- a deque never moves its elements, so the views in `index` remain valid
+    std::deque<std::string> spellings;
+    std::unordered_map<std::string_view, Atom_t> index;
+    mutable std::mutex lock;
+
+
+public:
+    Interner(void);
+
+
+public:
+    Atom_t Intern(std::string_view s);
+    Atom_t InternFolded(const char *s, size_t len);
+    const std::string &Spelling(Atom_t a) const { std::lock_guard<std::mutex> g(lock); return spellings[a]; }
+    size_t Count(void) const { std::lock_guard<std::mutex> g(lock); return spellings.size(); }
+};
+
+
+extern Interner atoms;
+
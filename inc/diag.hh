@@ -43,19 +43,58 @@ enum class DiagID {
     InvalidPrimaryExpr,
     InvalidExpression,
     MissingBasicDeclaration,
+    NestingTooDeep,
     UnknownError,
 };
 
 
 
+//
+// -- The severity of a diagnostic message
+//    ------------------------------------
+enum class DiagLevel : uint8_t {
+    Error,
+    Warning,
+    Note,
+};
+
+
+
 //
 // -- Handle all of the diagnostic messages for the compiler
-//    ------------------------------------------------------
+//
+//    Most messages are queued inside speculative parses and then thrown away when the parse backs up,
+//    so a message is only queued as a compact record: its id, its location handle, its arguments as
+//    atoms and the productions it was reported from.  It is formatted when the queue is flushed.
+//    -----------------------------------------------------------------------------------------------
 class Diagnostics {
+public:
+    using Diag_t = struct Diag_t {
+        DiagLevel level;
+        DiagID id;
+        SourceLoc_t loc;
+        uint32_t args;                  // -- the first argument in `argPool`
+        uint32_t argCount;
+        uint32_t frames;                // -- the outermost production in `framePool`
+        uint32_t frameCount;
+    };
+
+    // -- a message copied out of the queue, keeping only the productions past the first `skip`
+    using Saved_t = struct Saved_t {
+        DiagLevel level;
+        DiagID id;
+        SourceLoc_t loc;
+        std::vector<Atom_t> args;
+        std::vector<ProdID> frames;
+    };
+
+
 private:
     Parser *parser;
     static const std::unordered_map<DiagID, std::string> DiagMsgs;
-    std::vector<std::string> msgQueue;
+    std::vector<Diag_t> msgQueue;
+    std::vector<Atom_t> argPool;
+    std::vector<ProdID> framePool;
     int warnings;
     int errors;
 
@@ -70,33 +109,39 @@ public:
 
     // -- public interface functions
 public:
-    void Error(SourceLoc_t loc, DiagID id, std::vector<std::string> args = {}) {
+    void Error(SourceLoc_t loc, DiagID id, std::initializer_list<std::string_view> args = {}) {
         errors ++;
-        Emit("error", id, loc, args);
+        Emit(DiagLevel::Error, id, loc, args);
     }
-    void Warning(SourceLoc_t loc, DiagID id, std::vector<std::string> args = {}) {
+    void Warning(SourceLoc_t loc, DiagID id, std::initializer_list<std::string_view> args = {}) {
         warnings ++;
-        Emit("warning", id, loc, args);
+        Emit(DiagLevel::Warning, id, loc, args);
     }
-    void Note(SourceLoc_t loc, DiagID id, std::vector<std::string> args = {}) {
-        Emit("note", id, loc, args);
+    void Note(SourceLoc_t loc, DiagID id, std::initializer_list<std::string_view> args = {}) {
+        Emit(DiagLevel::Note, id, loc, args);
     }
     void Debug(std::string s) { std::cerr << s << '\n'; }
 
 
 private:
-    void Emit(const std::string &level, DiagID id, SourceLoc_t loc, const std::vector<std::string> &args);
-    std::string Format(std::string tmpl, const std::vector<std::string> args);
+    void Emit(DiagLevel level, DiagID id, SourceLoc_t loc, std::initializer_list<std::string_view> args);
+    void Snapshot(Diag_t &d);
+    std::string Render(const Diag_t &d) const;
+    std::string Format(const std::string &tmpl, const Atom_t *args, size_t argCount) const;
 
 
 public:
-    void Queue(std::string msg) { msgQueue.push_back(msg); }
     size_t Checkpoint(void) const { return msgQueue.size(); }
-    void Rollback(size_t loc) { assert(loc <= msgQueue.size()); msgQueue.resize(loc); }
-    void Flush(void) {
-        for (const auto &m : msgQueue) { assert(!m.empty()); }
-        for (auto m : msgQueue) { std::cerr << m; } msgQueue.clear();
+    void Rollback(size_t loc) {
+        assert(loc <= msgQueue.size());
+        if (loc == msgQueue.size()) return;
+        argPool.resize(msgQueue[loc].args);
+        framePool.resize(msgQueue[loc].frames);
+        msgQueue.resize(loc);
     }
+    bool Since(size_t loc, size_t skip, std::vector<Saved_t> &to) const;
+    void Replay(const Saved_t &d);
+    void Flush(void);
     int &Errors(void) { return errors; }
     int &Warnings(void) { return warnings; }
 };
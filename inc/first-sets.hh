@@ -0,0 +1,263 @@
+//=================================================================================================================
+//  first-sets.hh -- This header defines the FIRST set of each production
+//
+//        Copyright (c)  2025-2026 -- Adam Clark; See LICENSE.md
+//
+//  The FIRST set of a production is the set of tokens which can begin it.  A production which tries its
+//  alternatives in turn can look at the current token and try only the alternatives whose FIRST set
+//  holds it, leaving the backtracking for the alternatives which really do begin alike (such as an
+//  `object_declaration` and a `number_declaration`, which both begin with an identifier list).
+//
+//  The sets are not written out by hand.  Each production lists only what it begins with -- tokens
+//  or other productions -- as the parser is written, and the sets are closed over those lists at
+//  compile time.  A production which can match nothing lists what can begin it when it does match.
+//
+// ---------------------------------------------------------------------------------------------------------------
+//
+//     Date      Tracker  Version  Pgmr  Description
+//  -----------  -------  -------  ----  -------------------------------------------------------------------------
+//  2026-Oct-17  Initial   0.0.0   ADCL  Initial version
+//
+//=================================================================================================================
+
+
+
+//
+// -- A set of tokens, as a bitmap over the token values
+//    --------------------------------------------------
+inline constexpr size_t tokenSetWords = ((size_t)TokenType::TOK_ERROR + 64) / 64;
+
+
+using TokenSet_t = struct TokenSet_t {
+    uint64_t bits[tokenSetWords];
+
+    constexpr bool Has(TokenType tok) const {
+        return (bits[(size_t)tok / 64] >> ((size_t)tok % 64)) & 1;
+    }
+    constexpr void Add(TokenType tok) { bits[(size_t)tok / 64] |= (uint64_t)1 << ((size_t)tok % 64); }
+    constexpr bool Merge(const TokenSet_t &other) {
+        bool changed = false;
+
+        for (size_t i = 0; i < tokenSetWords; i ++) {
+            uint64_t b = bits[i] | other.bits[i];
+            if (b != bits[i]) changed = true;
+            bits[i] = b;
+        }
+
+        return changed;
+    }
+};
+
+
+
+//
+// -- One thing a production can begin with: a token or another production
+//    ---------------------------------------------------------------------
+using FirstRule_t = struct FirstRule_t {
+    ProdID prod;
+    bool isToken;
+    TokenType tok;
+    ProdID sub;
+};
+
+
+constexpr FirstRule_t Begins(ProdID p, TokenType tok) { return FirstRule_t { p, true, tok, p }; }
+constexpr FirstRule_t Begins(ProdID p, ProdID sub) { return FirstRule_t { p, false, TokenType::YYEOF, sub }; }
+
+
+
+//
+// -- What each production begins with.  The productions which are not written yet (such as
+//    `subprogram_declaration`) never match, so they add nothing here.
+//    -------------------------------------------------------------------------------------
+inline constexpr FirstRule_t firstRules[] = {
+    Begins(ProdID::AccessTypeDefinition,            TokenType::TOK_ACCESS),
+    Begins(ProdID::Aggregate,                       TokenType::TOK_LEFT_PARENTHESIS),
+    Begins(ProdID::AggregateMore,                   TokenType::TOK_COMMA),
+    Begins(ProdID::AggregateMore,                   TokenType::TOK_RIGHT_PARENTHESIS),
+    Begins(ProdID::Allocator,                       TokenType::TOK_NEW),
+    Begins(ProdID::ArrayTypeDefinition,             ProdID::UnconstrainedArrayDefinition),
+    Begins(ProdID::ArrayTypeDefinition,             ProdID::ConstrainedArrayDefinitionId),
+    Begins(ProdID::Attribute,                       ProdID::Prefix),
+    Begins(ProdID::AttributeDesignator,             TokenType::TOK_DIGITS),
+    Begins(ProdID::AttributeDesignator,             TokenType::TOK_DELTA),
+    Begins(ProdID::AttributeDesignator,             TokenType::TOK_RANGE),
+    Begins(ProdID::AttributeDesignator,             ProdID::SimpleName),
+    Begins(ProdID::BasicDeclaration,                ProdID::ObjectDeclaration),
+    Begins(ProdID::BasicDeclaration,                ProdID::NumberDeclaration),
+    Begins(ProdID::BasicDeclaration,                ProdID::TypeDeclaration),
+    Begins(ProdID::BasicDeclaration,                ProdID::SubtypeDeclaration),
+    Begins(ProdID::BasicDeclarativeItem,            ProdID::BasicDeclaration),
+    Begins(ProdID::BinaryAddingOperator,            TokenType::TOK_PLUS),
+    Begins(ProdID::BinaryAddingOperator,            TokenType::TOK_MINUS),
+    Begins(ProdID::BinaryAddingOperator,            TokenType::TOK_AMPERSAND),
+    Begins(ProdID::Body,                            ProdID::ProperBody),
+    Begins(ProdID::Choice,                          TokenType::TOK_OTHERS),
+    Begins(ProdID::Choice,                          ProdID::DiscreteRange),
+    Begins(ProdID::Choice,                          ProdID::SimpleName),
+    Begins(ProdID::Choice,                          ProdID::SimpleExpression),
+    Begins(ProdID::ComponentAssociation,            ProdID::Choice),
+    Begins(ProdID::ComponentAssociation,            ProdID::Expression),
+    Begins(ProdID::ComponentDeclaration,            ProdID::IdentifierList),
+    Begins(ProdID::ComponentList,                   TokenType::TOK_NULL),
+    Begins(ProdID::ComponentList,                   ProdID::ComponentDeclaration),
+    Begins(ProdID::ComponentList,                   ProdID::VariantPart),
+    Begins(ProdID::ComponentSubtypeDefinition,      ProdID::SubtypeIndication),
+    Begins(ProdID::ConstrainedArrayDefinitionId,    TokenType::TOK_ARRAY),
+    Begins(ProdID::ConstrainedArrayDefinitionList,  TokenType::TOK_ARRAY),
+    Begins(ProdID::Constraint,                      ProdID::RangeConstraint),
+    Begins(ProdID::Constraint,                      ProdID::FloatingPointConstraint),
+    Begins(ProdID::Constraint,                      ProdID::FixedPointConstraint),
+    Begins(ProdID::Constraint,                      ProdID::IndexConstraint),
+    Begins(ProdID::Constraint,                      ProdID::DiscriminantConstraint),
+    Begins(ProdID::DeclarativePart,                 ProdID::BasicDeclarativeItem),
+    Begins(ProdID::DeclarativePart,                 ProdID::LaterDeclarativeItem),
+    Begins(ProdID::DerivedTypeDefinition,           TokenType::TOK_NEW),
+    Begins(ProdID::DiscreteRange,                   ProdID::SubtypeIndication),
+    Begins(ProdID::DiscreteRange,                   ProdID::Range),
+    Begins(ProdID::DiscriminantAssociation,         ProdID::SimpleName),
+    Begins(ProdID::DiscriminantAssociation,         ProdID::Expression),
+    Begins(ProdID::DiscriminantConstraint,          TokenType::TOK_LEFT_PARENTHESIS),
+    Begins(ProdID::DiscriminantPart,                TokenType::TOK_LEFT_PARENTHESIS),
+    Begins(ProdID::DiscriminantSpecification,       ProdID::IdentifierList),
+    Begins(ProdID::EnumerationLiteral,              TokenType::TOK_CHARACTER_LITERAL),
+    Begins(ProdID::EnumerationLiteral,              TokenType::TOK_IDENTIFIER),
+    Begins(ProdID::EnumerationLiteralSpecification, ProdID::EnumerationLiteral),
+    Begins(ProdID::EnumerationTypeDefinition,       TokenType::TOK_LEFT_PARENTHESIS),
+    Begins(ProdID::Expression,                      ProdID::Relation),
+    Begins(ProdID::Factor,                          TokenType::TOK_ABS),
+    Begins(ProdID::Factor,                          TokenType::TOK_NOT),
+    Begins(ProdID::Factor,                          ProdID::Primary),
+    Begins(ProdID::FixedAccuracyDefinition,         TokenType::TOK_DELTA),
+    Begins(ProdID::FixedPointConstraint,            ProdID::FixedAccuracyDefinition),
+    Begins(ProdID::FloatingAccuracyDefinition,      TokenType::TOK_DIGITS),
+    Begins(ProdID::FloatingPointConstraint,         ProdID::FloatingAccuracyDefinition),
+    Begins(ProdID::FullTypeDefinition,              TokenType::TOK_TYPE),
+    Begins(ProdID::IdentifierList,                  TokenType::TOK_IDENTIFIER),
+    Begins(ProdID::IncompleteTypeDeclaration,       TokenType::TOK_TYPE),
+    Begins(ProdID::IndexConstraint,                 TokenType::TOK_LEFT_PARENTHESIS),
+    Begins(ProdID::IndexSubtypeDefinition,          ProdID::TypeMark),
+    Begins(ProdID::IndexedComponent,                ProdID::Prefix),
+    Begins(ProdID::IndexedComponentSuffix,          ProdID::Expression),
+    Begins(ProdID::IntegerTypeDefinition,           ProdID::RangeConstraint),
+    Begins(ProdID::LaterDeclarativeItem,            ProdID::Body),
+    Begins(ProdID::MultiplyingOperator,             TokenType::TOK_STAR),
+    Begins(ProdID::MultiplyingOperator,             TokenType::TOK_SLASH),
+    Begins(ProdID::MultiplyingOperator,             TokenType::TOK_MOD),
+    Begins(ProdID::MultiplyingOperator,             TokenType::TOK_REM),
+    Begins(ProdID::NameAttribute,                   TokenType::TOK_APOSTROPHE),
+    Begins(ProdID::NameBase,                        TokenType::TOK_CHARACTER_LITERAL),
+    Begins(ProdID::NameBase,                        ProdID::SimpleName),
+    Begins(ProdID::NameExpr,                        ProdID::NameBase),
+    Begins(ProdID::NameIndexOrSelectedComponent,    ProdID::SliceSuffix),
+    Begins(ProdID::NameIndexOrSelectedComponent,    ProdID::IndexedComponentSuffix),
+    Begins(ProdID::NameIndexOrSelectedComponent,    ProdID::SelectedComponentSuffix),
+    Begins(ProdID::NameNonExpr,                     TokenType::TOK_CHARACTER_LITERAL),
+    Begins(ProdID::NameNonExpr,                     ProdID::SimpleName),
+    Begins(ProdID::NameNonExpr,                     ProdID::IndexedComponent),
+    Begins(ProdID::NameNonExpr,                     ProdID::Slice),
+    Begins(ProdID::NameNonExpr,                     ProdID::SelectedComponent),
+    Begins(ProdID::NameNonExpr,                     ProdID::Attribute),
+    Begins(ProdID::NamePostfix,                     TokenType::TOK_LEFT_PARENTHESIS),
+    Begins(ProdID::NamePostfix,                     ProdID::SelectedComponentSuffix),
+    Begins(ProdID::NamePostfix,                     ProdID::NameAttribute),
+    Begins(ProdID::NumberDeclaration,               ProdID::IdentifierList),
+    Begins(ProdID::ObjectDeclaration,               ProdID::IdentifierList),
+    Begins(ProdID::Prefix,                          ProdID::NameExpr),
+    Begins(ProdID::Primary,                         TokenType::TOK_NULL),
+    Begins(ProdID::Primary,                         TokenType::TOK_UNIVERSAL_INT_LITERAL),
+    Begins(ProdID::Primary,                         TokenType::TOK_UNIVERSAL_REAL_LITERAL),
+    Begins(ProdID::Primary,                         TokenType::TOK_STRING_LITERAL),
+    Begins(ProdID::Primary,                         ProdID::Allocator),
+    Begins(ProdID::Primary,                         ProdID::NameExpr),
+    Begins(ProdID::Primary,                         ProdID::QualifiedExpression),
+    Begins(ProdID::Primary,                         ProdID::TypeConversion),
+    Begins(ProdID::Primary,                         ProdID::Aggregate),
+    Begins(ProdID::QualifiedExpression,             ProdID::TypeMark),
+    Begins(ProdID::Range,                           ProdID::Attribute),
+    Begins(ProdID::Range,                           ProdID::SimpleExpression),
+    Begins(ProdID::RangeConstraint,                 TokenType::TOK_RANGE),
+    Begins(ProdID::RealTypeDefinition,              ProdID::FloatingPointConstraint),
+    Begins(ProdID::RealTypeDefinition,              ProdID::FixedPointConstraint),
+    Begins(ProdID::RecordTypeDefinition,            TokenType::TOK_RECORD),
+    Begins(ProdID::Relation,                        ProdID::SimpleExpression),
+    Begins(ProdID::RelationalOperator,              TokenType::TOK_EQUAL),
+    Begins(ProdID::RelationalOperator,              TokenType::TOK_INEQUALITY),
+    Begins(ProdID::RelationalOperator,              TokenType::TOK_LESS_THAN),
+    Begins(ProdID::RelationalOperator,              TokenType::TOK_LESS_THAN_OR_EQUAL),
+    Begins(ProdID::RelationalOperator,              TokenType::TOK_GREATER_THAN),
+    Begins(ProdID::RelationalOperator,              TokenType::TOK_GREATER_THAN_OR_EQUAL),
+    Begins(ProdID::SelectedComponent,               ProdID::Prefix),
+    Begins(ProdID::SelectedComponentSuffix,         TokenType::TOK_DOT),
+    Begins(ProdID::Selector,                        TokenType::TOK_ALL),
+    Begins(ProdID::Selector,                        TokenType::TOK_CHARACTER_LITERAL),
+    Begins(ProdID::Selector,                        ProdID::SimpleName),
+    Begins(ProdID::SimpleExpression,                ProdID::UnaryAddingOperator),
+    Begins(ProdID::SimpleExpression,                ProdID::Term),
+    Begins(ProdID::SimpleName,                      TokenType::TOK_IDENTIFIER),
+    Begins(ProdID::Slice,                           ProdID::Prefix),
+    Begins(ProdID::SliceSuffix,                     ProdID::DiscreteRange),
+    Begins(ProdID::SubtypeDeclaration,              TokenType::TOK_SUBTYPE),
+    Begins(ProdID::SubtypeIndication,               ProdID::TypeMark),
+    Begins(ProdID::Term,                            ProdID::Factor),
+    Begins(ProdID::TypeConversion,                  ProdID::TypeMark),
+    Begins(ProdID::TypeDeclaration,                 ProdID::FullTypeDefinition),
+    Begins(ProdID::TypeDeclaration,                 ProdID::IncompleteTypeDeclaration),
+    Begins(ProdID::TypeDefinition,                  ProdID::EnumerationTypeDefinition),
+    Begins(ProdID::TypeDefinition,                  ProdID::IntegerTypeDefinition),
+    Begins(ProdID::TypeDefinition,                  ProdID::RealTypeDefinition),
+    Begins(ProdID::TypeDefinition,                  ProdID::ArrayTypeDefinition),
+    Begins(ProdID::TypeDefinition,                  ProdID::RecordTypeDefinition),
+    Begins(ProdID::TypeDefinition,                  ProdID::AccessTypeDefinition),
+    Begins(ProdID::TypeDefinition,                  ProdID::DerivedTypeDefinition),
+    Begins(ProdID::TypeMark,                        ProdID::NameNonExpr),
+    Begins(ProdID::UnaryAddingOperator,             TokenType::TOK_PLUS),
+    Begins(ProdID::UnaryAddingOperator,             TokenType::TOK_MINUS),
+    Begins(ProdID::UnconstrainedArrayDefinition,    TokenType::TOK_ARRAY),
+    Begins(ProdID::Variant,                         TokenType::TOK_WHEN),
+    Begins(ProdID::VariantPart,                     TokenType::TOK_CASE),
+};
+
+
+
+//
+// -- Close the sets over the rules: keep adding the sets of the productions each one begins with until
+//    nothing changes
+//    -------------------------------------------------------------------------------------------------
+using FirstSets_t = struct FirstSets_t {
+    TokenSet_t set[std::size(productions)];
+};
+
+
+constexpr FirstSets_t MakeFirstSets(void)
+{
+    FirstSets_t sets = {};
+    bool changed = true;
+
+    for (const FirstRule_t &r : firstRules) {
+        if (r.isToken) sets.set[(size_t)r.prod].Add(r.tok);
+    }
+
+    while (changed) {
+        changed = false;
+
+        for (const FirstRule_t &r : firstRules) {
+            if (!r.isToken && sets.set[(size_t)r.prod].Merge(sets.set[(size_t)r.sub])) changed = true;
+        }
+    }
+
+    return sets;
+}
+
+
+inline constexpr FirstSets_t firstSets = MakeFirstSets();
+static_assert(firstSets.set[(size_t)ProdID::Expression].Has(TokenType::TOK_LEFT_PARENTHESIS),
+        "the FIRST sets were not closed");
+
+
+
+//
+// -- Can a production begin with a token?
+//    ------------------------------------
+inline bool First(ProdID p, TokenType tok) { return firstSets.set[(size_t)p].Has(tok); }
+
@@ -0,0 +1,113 @@
+//=================================================================================================================
+//  journal.hh -- This header defines the undo journal which backs every speculative parse
+//
+//        Copyright (c)  2025-2026 -- Adam Clark; See LICENSE.md
+//
+//  A speculative parse can change the token position, queue diagnostics, build part of the tree,
+//  declare symbols, retire an incomplete type and push or pop scopes.  Rather than each of these having
+//  a mark class of its own which has to be nested in the right order, a checkpoint is one integer into
+//  the journal.  The state which only ever grows (tokens, diagnostics, the tree) is kept as its size at
+//  the checkpoint; every change to the symbol table is written to an undo log as it is made, and
+//  rolling back replays the log in reverse down to the checkpoint before the sizes are restored.
+//
+//  Nothing is logged when no checkpoint is open, and the log is emptied whenever the last one is
+//  released, so it only ever holds the changes of the speculation in progress.
+//
+// ---------------------------------------------------------------------------------------------------------------
+//
+//     Date      Tracker  Version  Pgmr  Description
+//  -----------  -------  -------  ----  -------------------------------------------------------------------------
+//  2026-Oct-17  Initial   0.0.0   ADCL  Initial version
+//
+//=================================================================================================================
+
+
+
+//
+// -- The journal for one compilation
+//    -------------------------------
+class Journal {
+    Journal(const Journal &) = delete;
+    Journal &operator=(const Journal &) = delete;
+
+
+public:
+    using Checkpoint_t = uint32_t;
+
+
+private:
+    // -- the kinds of change to the symbol table which can be undone
+    enum class UndoKind : uint8_t {
+        Declare,                // -- a symbol was declared in `scope`
+        Retire,                 // -- `sym` was retired from kind `was`
+        PushScope,              // -- a scope was pushed while `scope` was current
+        PopScope,               // -- a scope was popped while `scope` was current
+    };
+
+    using Undo_t = struct Undo_t {
+        UndoKind kind;
+        Symbol::SymbolKind was;
+        union {
+            Scope *scope;
+            Symbol *sym;
+        };
+    };
+
+
+    // -- everything which is restored by size rather than by undoing it
+    using Mark_t = struct Mark_t {
+        size_t undo;
+        int token;
+        size_t diag;
+        int errors;
+        int warnings;
+        AST::Checkpoint_t tree;
+        uint64_t epoch;
+    };
+
+
+private:
+    TokenStream &tokens;
+    Diagnostics &diags;
+    AST &tree;
+    ScopeManager &scopes;
+    std::vector<Undo_t> log;
+    std::vector<Mark_t> marks;
+    ParseProfile *profile = nullptr;
+
+
+private:
+    void Record(UndoKind kind, Scope *scope) {
+        if (marks.empty()) return;
+        Undo_t u { kind, Symbol::SymbolKind::Deleted, {} };
+        u.scope = scope;
+        log.push_back(u);
+    }
+
+
+public:
+    Journal(TokenStream &t, Diagnostics &d, AST &a, ScopeManager &s) : tokens(t), diags(d), tree(a), scopes(s) {}
+
+
+public:
+    size_t Depth(void) const { return marks.size(); }
+    void Profile(ParseProfile *p) { profile = p; }
+    Checkpoint_t Checkpoint(void);
+    void Rollback(Checkpoint_t cp);
+    void Release(Checkpoint_t cp);
+
+
+public:
+    // -- the changes to the symbol table, as they are made
+    void Declared(Scope *scope) { Record(UndoKind::Declare, scope); }
+    void Pushed(Scope *current) { Record(UndoKind::PushScope, current); }
+    void Popped(Scope *current) { Record(UndoKind::PopScope, current); }
+    void Retired(Symbol *sym, Symbol::SymbolKind was) {
+        if (marks.empty()) return;
+        Undo_t u { UndoKind::Retire, was, {} };
+        u.sym = sym;
+        log.push_back(u);
+    }
+};
+
+
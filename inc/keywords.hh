@@ -0,0 +1,154 @@
+//=================================================================================================================
+//  keywords.hh -- This header defines the reserved words and how they are recognized
+//
+//        Copyright (c)  2025-2026 -- Adam Clark; See LICENSE.md
+//
+//  This table is the only list of the reserved words; both the flex scanner and the hand-written lexer
+//  match an identifier and then look it up here.  The lookup is a perfect hash: the seed for the hash
+//  is searched for at compile time so that every reserved word lands in a slot of its own, and a
+//  lookup is then a hash of the word, one slot and one compare.
+//
+// ---------------------------------------------------------------------------------------------------------------
+//
+//     Date      Tracker  Version  Pgmr  Description
+//  -----------  -------  -------  ----  -------------------------------------------------------------------------
+//  2026-Oct-17  Initial   0.0.0   ADCL  Initial version
+//
+//=================================================================================================================
+
+
+
+//
+// -- The reserved words, in lower case
+//    ---------------------------------
+using Keyword_t = struct Keyword_t {
+    std::string_view text;
+    TokenType tok;
+};
+
+
+inline constexpr Keyword_t keywords[] = {
+    { "abort",     TokenType::TOK_ABORT },      { "abs",       TokenType::TOK_ABS },
+    { "accept",    TokenType::TOK_ACCEPT },     { "access",    TokenType::TOK_ACCESS },
+    { "all",       TokenType::TOK_ALL },        { "and",       TokenType::TOK_AND },
+    { "array",     TokenType::TOK_ARRAY },      { "at",        TokenType::TOK_AT },
+    { "begin",     TokenType::TOK_BEGIN },      { "body",      TokenType::TOK_BODY },
+    { "case",      TokenType::TOK_CASE },       { "constant",  TokenType::TOK_CONSTANT },
+    { "declare",   TokenType::TOK_DECLARE },    { "delay",     TokenType::TOK_DELAY },
+    { "delta",     TokenType::TOK_DELTA },      { "digits",    TokenType::TOK_DIGITS },
+    { "do",        TokenType::TOK_DO },         { "else",      TokenType::TOK_ELSE },
+    { "elsif",     TokenType::TOK_ELSIF },      { "end",       TokenType::TOK_END },
+    { "entry",     TokenType::TOK_ENTRY },      { "exception", TokenType::TOK_EXCEPTION },
+    { "exit",      TokenType::TOK_EXIT },       { "for",       TokenType::TOK_FOR },
+    { "function",  TokenType::TOK_FUNCTION },   { "generic",   TokenType::TOK_GENERIC },
+    { "goto",      TokenType::TOK_GOTO },       { "if",        TokenType::TOK_IF },
+    { "in",        TokenType::TOK_IN },         { "is",        TokenType::TOK_IS },
+    { "limited",   TokenType::TOK_LIMITED },    { "loop",      TokenType::TOK_LOOP },
+    { "mod",       TokenType::TOK_MOD },        { "new",       TokenType::TOK_NEW },
+    { "not",       TokenType::TOK_NOT },        { "null",      TokenType::TOK_NULL },
+    { "of",        TokenType::TOK_OF },         { "or",        TokenType::TOK_OR },
+    { "others",    TokenType::TOK_OTHERS },     { "out",       TokenType::TOK_OUT },
+    { "package",   TokenType::TOK_PACKAGE },    { "pragma",    TokenType::TOK_PRAGMA },
+    { "private",   TokenType::TOK_PRIVATE },    { "procedure", TokenType::TOK_PROCEDURE },
+    { "raise",     TokenType::TOK_RAISE },      { "range",     TokenType::TOK_RANGE },
+    { "record",    TokenType::TOK_RECORD },     { "rem",       TokenType::TOK_REM },
+    { "renames",   TokenType::TOK_RENAMES },    { "return",    TokenType::TOK_RETURN },
+    { "reverse",   TokenType::TOK_REVERSE },    { "select",    TokenType::TOK_SELECT },
+    { "separate",  TokenType::TOK_SEPARATE },   { "subtype",   TokenType::TOK_SUBTYPE },
+    { "task",      TokenType::TOK_TASK },       { "terminate", TokenType::TOK_TERMINATE },
+    { "then",      TokenType::TOK_THEN },       { "type",      TokenType::TOK_TYPE },
+    { "use",       TokenType::TOK_USE },        { "when",      TokenType::TOK_WHEN },
+    { "while",     TokenType::TOK_WHILE },      { "with",      TokenType::TOK_WITH },
+    { "xor",       TokenType::TOK_XOR },
+};
+
+
+
+//
+// -- The hash table has 512 slots, each holding the index of its reserved word plus 1 (0 is empty)
+//    ---------------------------------------------------------------------------------------------
+inline constexpr int keywordHashBits = 9;
+inline constexpr size_t keywordSlots = 1 << keywordHashBits;
+
+
+using KeywordTable_t = struct KeywordTable_t {
+    uint32_t seed;
+    size_t longest;
+    uint8_t slot[keywordSlots];
+};
+
+
+
+//
+// -- Hash a word, folding its case; identifiers hold only letters, digits and '_', so setting the
+//    0x20 bit folds the letters and leaves the rest apart from one another
+//    ---------------------------------------------------------------------------------------------
+constexpr uint32_t KeywordHash(uint32_t seed, const char *s, size_t len)
+{
+    uint32_t h = seed;
+
+    for (size_t i = 0; i < len; i ++) h = (h ^ (uint8_t)(s[i] | 0x20)) * 0x01000193u;
+
+    return h >> (32 - keywordHashBits);
+}
+
+
+
+//
+// -- Search for the first seed which puts every reserved word in a slot of its own, and build the table
+//    --------------------------------------------------------------------------------------------------
+constexpr KeywordTable_t MakeKeywordTable(void)
+{
+    KeywordTable_t table = {};
+
+    for (uint32_t seed = 1; seed != 0; seed ++) {
+        bool clash = false;
+
+        for (size_t i = 0; i < keywordSlots; i ++) table.slot[i] = 0;
+
+        for (size_t k = 0; !clash && k < std::size(keywords); k ++) {
+            uint32_t h = KeywordHash(seed, keywords[k].text.data(), keywords[k].text.size());
+
+            if (table.slot[h]) clash = true;
+            else table.slot[h] = k + 1;
+        }
+
+        if (!clash) {
+            table.seed = seed;
+            break;
+        }
+    }
+
+    for (const Keyword_t &k : keywords) {
+        if (k.text.size() > table.longest) table.longest = k.text.size();
+    }
+
+    return table;
+}
+
+
+inline constexpr KeywordTable_t keywordTable = MakeKeywordTable();
+static_assert(keywordTable.seed != 0, "no perfect hash for the reserved words");
+
+
+
+//
+// -- Look up an identifier (in any case), returning its reserved word or TOK_IDENTIFIER
+//    ----------------------------------------------------------------------------------
+inline TokenType Keyword(const char *s, size_t len)
+{
+    if (len > keywordTable.longest) return TokenType::TOK_IDENTIFIER;
+
+    uint8_t slot = keywordTable.slot[KeywordHash(keywordTable.seed, s, len)];
+    if (!slot) return TokenType::TOK_IDENTIFIER;
+
+    const Keyword_t &k = keywords[slot - 1];
+    if (k.text.size() != len) return TokenType::TOK_IDENTIFIER;
+
+    for (size_t i = 0; i < len; i ++) {
+        if ((s[i] | 0x20) != k.text[i]) return TokenType::TOK_IDENTIFIER;
+    }
+
+    return k.tok;
+}
+
@@ -0,0 +1,152 @@
+//=================================================================================================================
+//  lexer.hh -- This header defines the interface to the lexers which can feed the token stream
+//
+//        Copyright (c)  2025-2026 -- Adam Clark; See LICENSE.md
+//
+//  There are 2 lexers which produce exactly the same tokens:
+//  * `FlexAdapter` wraps the flex scanner generated from `scanner.ll`, which is the reference
+//  * `FastLexer` is hand-written and classifies characters with SIMD tables, skipping whitespace,
+//    comments, identifiers and string bodies a vector at a time
+//
+//  Both work directly from the source buffer.  `Offset()` is the offset of the text matched last (for a
+//  string literal, that is the closing quote), `Line()` is the number of line feeds consumed so far and
+//  `Column()` is the scanner column after the token -- exactly what the flex scanner reports.
+//
+//  A lexer may also be created over a window of the source which starts at the beginning of a line.
+//  Offsets are still reported from the start of the source, but lines are counted from the start of the
+//  window.  `AtBoundary()` tells whether the lexer is back in its initial state at the start of a line,
+//  which is what is needed for the text after the window to be lexed on its own.
+//
+// ---------------------------------------------------------------------------------------------------------------
+//
+//     Date      Tracker  Version  Pgmr  Description
+//  -----------  -------  -------  ----  -------------------------------------------------------------------------
+//  2026-Oct-17  Initial   0.0.0   ADCL  Initial version
+//
+//=================================================================================================================
+
+
+
+//
+// -- This is the abstract lexer
+//    --------------------------
+class Lexer {
+    Lexer(const Lexer &) = delete;
+    Lexer &operator=(const Lexer &) = delete;
+
+
+public:
+    enum class Kind {
+        Flex,
+        Fast,
+    };
+
+
+public:
+    Lexer(void) = default;
+    virtual ~Lexer() = default;
+
+
+public:
+    virtual TokenType Next(void) = 0;
+    virtual uint32_t Offset(void) const = 0;
+    virtual uint32_t Line(void) const = 0;
+    virtual uint32_t Column(void) const = 0;
+    virtual const YYSTYPE &Payload(void) const = 0;
+    virtual bool AtBoundary(void) const = 0;
+
+
+public:
+    static std::unique_ptr<Lexer> Create(Kind kind, const SourceFile &source);
+    static std::unique_ptr<Lexer> Create(Kind kind, const SourceFile &source, uint32_t from, uint32_t to);
+};
+
+
+
+//
+// -- The flex scanner behind the Lexer interface.  The scanner is reentrant and all of its state is
+//    held here, so there may be one of these per thread.  Flex needs its buffer to end in 2 NUL bytes,
+//    so a window is scanned from a copy and `origin` puts the offsets back in terms of the source.
+//    ------------------------------------------------------------------------------------------------
+class FlexAdapter : public Lexer {
+private:
+    ScanContext_t ctx;
+    void *scanner;
+    std::vector<char> window;       // -- the copy of a window; empty when scanning the whole source
+    uint32_t origin;                // -- the source offset of the start of the buffer being scanned
+
+
+public:
+    explicit FlexAdapter(const SourceFile &source);
+    FlexAdapter(const SourceFile &source, uint32_t from, uint32_t to);
+    virtual ~FlexAdapter();
+
+
+private:
+    void Begin(const SourceFile &source, char *buf, size_t size);
+
+
+public:
+    std::string_view Text(void) const;              // -- the text matched last
+
+    virtual TokenType Next(void) override;
+    virtual uint32_t Offset(void) const override;
+    virtual uint32_t Line(void) const override;
+    virtual uint32_t Column(void) const override;
+    virtual const YYSTYPE &Payload(void) const override;
+    virtual bool AtBoundary(void) const override;
+};
+
+
+
+//
+// -- The hand-written lexer
+//    ----------------------
+class FastLexer : public Lexer {
+private:
+    // -- the start conditions of the flex scanner; a string literal is always scanned in one call
+    enum class State {
+        Initial,
+        PragmaName,
+        PragmaArgs,
+    };
+
+
+private:
+    const char *base;
+    const char *p;                  // -- the next character to scan
+    const char *end;                // -- the end of the source text (the NULs are beyond this)
+    State state;
+    uint32_t offset;
+    uint32_t line;
+    uint32_t column;
+    YYSTYPE payload;
+
+
+public:
+    explicit FastLexer(const SourceFile &source);
+    FastLexer(const SourceFile &source, uint32_t from, uint32_t to);
+    virtual ~FastLexer() = default;
+
+
+private:
+    TokenType NextInitial(void);
+    TokenType NextPragmaName(void);
+    TokenType NextPragmaArgs(void);
+    TokenType Break(void);
+    TokenType Operator(void);
+    TokenType Identifier(bool keywords);
+    TokenType Number(void);
+    TokenType String(void);
+    void SkipBlanks(void);
+
+
+public:
+    virtual TokenType Next(void) override;
+    virtual uint32_t Offset(void) const override { return offset; }
+    virtual uint32_t Line(void) const override { return line; }
+    virtual uint32_t Column(void) const override { return column; }
+    virtual const YYSTYPE &Payload(void) const override { return payload; }
+    virtual bool AtBoundary(void) const override { return state == State::Initial && column == 1; }
+};
+
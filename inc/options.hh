@@ -16,8 +16,18 @@
 struct Options {
     bool trace = false;
     bool dumpSymtab = false;
+    bool dumpAST = false;
     bool listing = false;
     bool requireBasicDeclaration = false;
+    bool fastLexer = false;
+    unsigned lexJobs = 0;                       // -- threads for chunked lexing; 0 is one per processor
+    size_t chunkedLexSize = 4 << 20;            // -- files at least this big are lexed in chunks
+    bool streamTokens = false;                  // -- lex tokens only as the parser needs them
+    bool packrat = false;                       // -- memoize the productions which are backtracked over
+    std::string tokenCache;                     // -- the directory of cached token streams; empty for none
+    unsigned maxNesting = 256;                  // -- the deepest expressions may be nested in one another
+    bool parseProfile = false;                  // -- profile the productions and print the table at exit
+    std::string parseProfileJson;               // -- also write the profile here as JSON; empty for none
 };
 
 
@@ -14,68 +14,158 @@
 
 
 
+//
+// -- These are the productions whose results are kept in the packrat memo
+//    --------------------------------------------------------------------
+enum class MemoRule : uint8_t {
+    Expression,
+    Relation,
+    SimpleExpression,
+    Term,
+    Factor,
+    Primary,
+    Aggregate,
+    ComponentAssociation,
+    Choice,
+    DiscreteRange,
+    Range,
+    SubtypeIndication,
+    Constraint,
+};
+
+
+
+//
+// -- The precedence levels of the Ada operators, loosest first
+//    ---------------------------------------------------------
+enum class ExprLevel : uint8_t {
+    None,                   // -- not a binary operator
+    Logical,                // -- and, and then, or, or else, xor
+    Relational,             // -- = /= < <= > >= and the membership tests
+    Adding,                 // -- binary + - &, and the unary + - in front of the first term
+    Multiplying,            // -- * / mod rem
+    Highest,                // -- ** abs not
+};
+
+
+
 //
 // -- This class will handle the entirety of the parser
 //    -------------------------------------------------
 class Parser {
 private:
     TokenStream &tokens;
-    std::vector<std::string> stack;
     ScopeManager scopes;
+    AST ast;
+    Journal journal;
+    std::unique_ptr<ParseProfile> profile;
+
+
+private:
+    //
+    // -- The productions the parser is in, innermost last.  Productions nested deeper than the stack
+    //    is long are still counted in `depth` but are not kept, so they have no name.
+    //    ---------------------------------------------------------------------------------------------
+    static const int MaxProductionDepth = 1024;
+    ProdID stack[MaxProductionDepth];
+    int depth = 0;
+
+
+private:
+    //
+    // -- How deeply the primary being parsed is nested inside others (through parentheses, aggregates
+    //    and the arguments of names).  Each level costs a run of native frames, so it is held to
+    //    `opts.maxNesting`.
+    //    ---------------------------------------------------------------------------------------------
+    unsigned nesting = 0;
+
+
+private:
+    //
+    // -- The outcome of parsing a production at a token, which holds only while the symbol table is in
+    //    the same state (`epoch`).  The diagnostics are kept without the part of the production stack
+    //    outside the production, since that depends on where it is parsed from, and the tree it built
+    //    is kept to be built again.
+    //    ----------------------------------------------------------------------------------------------
+    using Memo_t = struct Memo_t {
+        uint64_t epoch;
+        bool ok;
+        int end;
+        int errors;
+        int warnings;
+        std::vector<Diagnostics::Saved_t> msgs;
+        AST::Fragment_t tree;
+    };
+
+    std::unordered_map<uint64_t, Memo_t> memo;
+
+
+private:
+    //
+    // -- What the identifier at a token names, which holds only while the symbol table is in the same
+    //    state (`epoch`).  Every alternative which is backtracked over an identifier looks it up again,
+    //    so the answer is kept in a slot chosen by the token's index, and the overloads are only walked
+    //    the first time.
+    //    ----------------------------------------------------------------------------------------------
+    using NameClass_t = struct NameClass_t {
+        bool known;             // -- declared at all
+        bool type;              // -- a type, a subtype included
+        bool subtype;           // -- a subtype
+        bool incomplete;        // -- an incomplete type, not yet completed
+        bool subprogram;
+        bool component;
+        bool object;
+    };
+
+    using NameSlot_t = struct NameSlot_t {
+        int token = -1;
+        Atom_t name = NoAtom;
+        uint64_t epoch = 0;
+        NameClass_t cls {};
+    };
+
+    static const int NameCacheSize = 256;
+    NameSlot_t names[NameCacheSize];
 
 
 private:
     using Id = struct Id {
-        std::string name;
+        Atom_t name = NoAtom;
         SourceLoc_t loc;
     };
 
     using IdList = std::vector<Id>;
 
 private:
+    //
+    // -- Open a checkpoint in the journal for a speculative parse.  Unless it is committed, everything
+    //    done since (tokens, diagnostics, the tree and the symbol table alike) is undone when it goes.
+    //    ------------------------------------------------------------------------------------------
     class MarkStream {
         MarkStream(const MarkStream &) = delete;
         MarkStream &operator=(const MarkStream &) = delete;
 
 
     private:
-        TokenStream &ts;
-        Diagnostics &diag;
-        int saved;
+        Journal &journal;
+        Journal::Checkpoint_t cp;
         bool committed;
-        size_t chkpt;
-        static int depth;
-        int errors;
-        int warnings;
 
 
     public:
-        MarkStream(TokenStream &t, Diagnostics &d) :
-                ts(t), diag(d), saved(ts.Location()), committed(false), errors(d.Errors()), warnings(d.Warnings()) {
-            ++depth;
-            chkpt = diag.Checkpoint();
-        }
+        MarkStream(Journal &j) : journal(j), cp(j.Checkpoint()), committed(false) {}
 
         ~MarkStream() {
-            --depth;
-            assert(depth >= 0);
-
-            if (!committed) {
-                ts.Reset(saved);
-                diag.Rollback(chkpt);
-                diag.Errors() = errors;
-                diag.Warnings() = warnings;
-            }
-
-            if (depth == 0) diag.Flush();
+            if (!committed) journal.Rollback(cp);
+            journal.Release(cp);
         }
 
     public:
         //
         // -- Parse in a single production has failed this far (typically an optional leading phrase)
-        //    and we need to reset to try the latter part.
+        //    and we need to reset to try the latter part.  Whatever was done since the mark is undone.
         //    ---------------------------------------------------------------------------------------
-        void Reset(void) { committed = false; ts.Reset(saved); }
+        void Reset(void) { committed = false; journal.Rollback(cp); }
         //
         // -- The following member method may be used for any production whether tokens are directly
         //    consumed or not.
@@ -92,64 +182,13 @@ private:
 
 
 private:
-    class MarkScope {
-        MarkScope(const MarkScope &) = delete;
-        MarkScope &operator=(const MarkScope &) = delete;
-
-
-    private:
-        ScopeManager &mgr;
-        bool committed = false;
-        size_t stackCkpt;
-        size_t scopeCkpt;
-
-
-    public:
-        MarkScope(ScopeManager &m) : mgr(m) {
-            stackCkpt = m.stack.size();
-            scopeCkpt = m.CurrentScope()->Checkpoint();
-        }
-        ~MarkScope() {
-            if (!committed) {
-                // -- roll back any added scopes
-                while (mgr.stack.size() > stackCkpt) {
-                    { // -- this creates a local scope in the loop to own the pointer for a short time
-                        std::unique_ptr<Scope> s = std::move(mgr.stack.back());
-                        mgr.stack.pop_back();
-                    }
-
-                    // -- should be nothing else to do
-                }
-
-
-                // -- rollback the symbols added in the original scope
-                mgr.CurrentScope()->Rollback(scopeCkpt);
-            }
-        }
-
-
-    public:
-        Scope *Commit(void) { committed = true; return mgr.CurrentScope(); }
-    };
-
-
-private:
-    class MarkSymbols {
+    class Nesting {
     private:
-        ScopeManager &mgr;
-        size_t checkpoint;
-        bool committed;
-
-    public:
-        MarkSymbols(ScopeManager &m) : mgr(m), checkpoint(mgr.CurrentScope()->Checkpoint()), committed(false) {}
-        ~MarkSymbols() {
-            if (!committed) {
-                mgr.CurrentScope()->Rollback(checkpoint);
-            }
-        }
+        Parser &parser;
 
     public:
-        void Commit(void) { committed = true; }
+        Nesting(Parser &parser) : parser(parser) { parser.nesting ++; }
+        ~Nesting() { parser.nesting --; }
     };
 
 
@@ -157,25 +196,51 @@ private:
     class Production {
     private:
         Parser &parser;
+        ProdID id;
+        int start;
+        SourceLoc_t loc;
+        AST::Checkpoint_t chkpt;
+        bool keep = false;
+        bool lift = false;
+        bool pass = false;
 
     public:
-        Production(Parser &parser, std::string p) : parser(parser)
+        Production(Parser &parser, ProdID p) : parser(parser), id(p), start(parser.tokens.Location()),
+                loc(parser.tokens.SourceLocation()), chkpt(parser.ast.Checkpoint())
         {
-            if (opts.trace) std::cerr << "Entering " << p << " from " << parser.Last() << '\n';
-            parser.stack.push_back(std::move(p));
-            std::cerr.flush();
+            if (opts.trace) std::cerr << "Entering " << ProductionName(p) << " from " << parser.Last() << '\n';
+            if (parser.depth < MaxProductionDepth) parser.stack[parser.depth] = p;
+            parser.depth ++;
+            if (parser.profile) parser.profile->Enter(p);
         }
         ~Production() {
             if (opts.trace) std::cerr << "Leaving " << parser.Last() << '\n';
-            parser.stack.pop_back();
-            std::cerr.flush();
+            parser.depth --;
+            if (parser.profile) parser.profile->Leave(parser.tokens.Location() != start);
+            int end = parser.tokens.Location();
+            if (!pass || end == start) parser.ast.Close(id, loc, chkpt, start, end, keep, lift);
         }
+
+    public:
+        // -- always give the production a node of its own, even around a single part (such as a list)
+        void Keep(void) { keep = true; }
+        // -- pass on a single part as it is, even when the production has tokens of its own
+        void Lift(void) { lift = true; }
+        // -- leave the parts as they are, with no node for the production (it turned out not to be one)
+        void Pass(void) { pass = true; }
     };
 
 
 
 public:
-    Parser(TokenStream &s) : tokens(s) {}
+    Parser(TokenStream &s) : tokens(s), journal(s, diags, ast, scopes) {
+        scopes.journal = &journal;
+
+        if (opts.parseProfile) {
+            profile = std::make_unique<ParseProfile>();
+            journal.Profile(profile.get());
+        }
+    }
     virtual ~Parser() = default;
 
 
@@ -195,6 +260,14 @@ public:
         }
         return false;
     }
+    // -- a token is optional and if found it is kept in the tree as a leaf
+    bool OptionalLeaf(TokenType tok) {
+        if (tokens.Current() == tok) {
+            Token();
+            return true;
+        }
+        return false;
+    }
     // -- a token is required to be next
     bool Require(TokenType tok) {
         if (tokens.Current() == tok) {
@@ -205,11 +278,11 @@ public:
         return false;
     }
     // -- DEPRECATED: An identifier is required to be next
-    bool RequireIdent(std::string &id) {
-        id = "";
+    bool RequireIdent(Atom_t &id) {
+        id = NoAtom;
         if (tokens.Current() == TokenType::TOK_IDENTIFIER) {
             id = std::get<IdentifierLexeme>(tokens.Payload()).name;
-            tokens.Advance();
+            Token();
             return true;
         }
         return false;
@@ -217,30 +290,32 @@ public:
 
     // -- An identifier is required to be next
     bool RequireIdent(Id &id) {
-        id.name = "";
+        id.name = NoAtom;
         id.loc = tokens.SourceLocation();
 
         if (tokens.Current() == TokenType::TOK_IDENTIFIER) {
             id.name = std::get<IdentifierLexeme>(tokens.Payload()).name;
-            tokens.Advance();
+            Token();
             return true;
         }
         return false;
     }
 
-    std::string Last(void) { if (stack.size() == 0) return "top level"; return stack[stack.size() - 1]; }
-    void Push(std::string p) { stack.push_back(p); }
-    void Pop(void) { stack.pop_back(); }
-    const ScopeManager *Scopes(void) const { return &scopes; }
-    std::string UnwindStack(void) {
-        std::string rv = "";
-        for (auto it = stack.rbegin(); it != stack.rend(); ++it) {
-            rv += "  in production `";
-            rv += *it;
-            rv += "`\n";
-        }
+    void Token(void);
+    bool Memoize(MemoRule rule, bool (Parser::*body)(void));
+    NameClass_t Classify(int token, Atom_t name);
 
-        return rv;
+    const char *Last(void) const {
+        if (depth == 0) return "top level";
+        if (depth > MaxProductionDepth) return "(too deep)";
+        return ProductionName(stack[depth - 1]);
+    }
+    const ScopeManager *Scopes(void) const { return &scopes; }
+    const AST *Tree(void) const { return &ast; }
+    const ParseProfile *Profile(void) const { return profile.get(); }
+    const ProdID *Frames(size_t &count) const {
+        count = depth < MaxProductionDepth ? depth : MaxProductionDepth;
+        return stack;
     }
 
 
@@ -297,6 +372,12 @@ public:
     bool ParseVariant(RecordTypeSymbol *rec);
     bool ParseVariantPart(RecordTypeSymbol *rec);
     bool _HelpParseConstrainedArrayDefinition(void);
+    bool ParseChoice_Body(void);
+    bool ParseConstraint_Body(void);
+    bool ParseDiscreteRange_Body(void);
+    bool ParseDiscreteRange_OrSimpleExpression(bool &range, bool choice);
+    bool ParseRange_Body(void);
+    bool ParseSubtypeIndication_Body(void);
 
 
 
@@ -333,11 +414,19 @@ public:
     bool ParseTerm(void);                                       // -- Ch 4: in `parse_expr.cc`
     bool ParseTypeConversion(void);                             // -- Ch 4: in `parse_expr.cc`
     bool ParseUnaryAddingOperator(void);                        // -- Ch 4: in `parse_expr.cc`
-    bool ParseName_IndexComponentSuffix(void);                  // -- Ch 4: in `parse_expr.cc`
-    bool ParseName_SliceSuffix(void);                           // -- Ch 4: in `parse_expr.cc`
     bool ParseName_SelectedComponentSuffix(void);               // -- Ch 4: in `parse_expr.cc`
     bool ParseName_AttributeSuffix(void);                       // -- Ch 4: in `parse_expr.cc`
     bool ParseName_IndexOrSliceSuffix(void);                    // -- Ch 4: in `parse_expr.cc`
+    bool ParseAggregate_Body(void);
+    bool ParseComponentAssociation_Body(void);
+    bool ParseExpression_Body(void);
+    bool ParseExpression_Operators(ExprLevel min, bool continued = false);
+    bool ParseFactor_Operand(void);
+    bool ParseFactor_Body(void);
+    bool ParsePrimary_Body(void);
+    bool ParseRelation_Body(void);
+    bool ParseSimpleExpression_Body(void);
+    bool ParseTerm_Body(void);
 
 
 
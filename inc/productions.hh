@@ -0,0 +1,226 @@
+//=================================================================================================================
+//  productions.hh -- This header defines the productions of the parser, as they are known to tracing and
+//                    to diagnostics
+//
+//        Copyright (c)  2025-2026 -- Adam Clark; See LICENSE.md
+//
+//  Each production is described once, here, by its id and its name.  The parser keeps the ids of the
+//  productions it is in on a fixed stack, so entering a production costs a store and an increment; the
+//  names are only looked up when tracing or when a diagnostic unwinds the stack.
+//
+// ---------------------------------------------------------------------------------------------------------------
+//
+//     Date      Tracker  Version  Pgmr  Description
+//  -----------  -------  -------  ----  -------------------------------------------------------------------------
+//  2026-Oct-17  Initial   0.0.0   ADCL  Initial version
+//
+//=================================================================================================================
+
+
+
+//
+// -- The productions, one for each place the parser enters one
+//    ---------------------------------------------------------
+enum class ProdID : uint8_t {
+    AccessTypeDefinition,
+    Aggregate,
+    AggregateMore,
+    Allocator,
+    ArrayTypeDefinition,
+    Attribute,
+    AttributeDesignator,
+    BasicDeclaration,
+    BasicDeclarativeItem,
+    BinaryAddingOperator,
+    Body,
+    Choice,
+    ComponentAssociation,
+    ComponentDeclaration,
+    ComponentList,
+    ComponentSubtypeDefinition,
+    ConstrainedArrayDefinitionId,
+    ConstrainedArrayDefinitionList,
+    Constraint,
+    DeclarativePart,
+    DerivedTypeDefinition,
+    DiscreteRange,
+    DiscriminantAssociation,
+    DiscriminantConstraint,
+    DiscriminantPart,
+    DiscriminantSpecification,
+    EnumerationLiteral,
+    EnumerationLiteralSpecification,
+    EnumerationTypeDefinition,
+    Expression,
+    Factor,
+    FixedAccuracyDefinition,
+    FixedPointConstraint,
+    FloatingAccuracyDefinition,
+    FloatingPointConstraint,
+    FullTypeDefinition,
+    IdentifierList,
+    IncompleteTypeDeclaration,
+    IndexConstraint,
+    IndexSubtypeDefinition,
+    IndexedComponent,
+    IndexedComponentSuffix,
+    IntegerTypeDefinition,
+    LaterDeclarativeItem,
+    MultiplyingOperator,
+    NameAttribute,
+    NameBase,
+    NameExpr,
+    NameIndexOrSelectedComponent,
+    NameNonExpr,
+    NamePostfix,
+    NumberDeclaration,
+    ObjectDeclaration,
+    Prefix,
+    Primary,
+    ProperBody,
+    QualifiedExpression,
+    Range,
+    RangeConstraint,
+    RealTypeDefinition,
+    RecordTypeDefinition,
+    Relation,
+    RelationalOperator,
+    SelectedComponent,
+    SelectedComponentSuffix,
+    Selector,
+    SimpleExpression,
+    SimpleName,
+    Slice,
+    SliceSuffix,
+    SubtypeDeclaration,
+    SubtypeIndication,
+    Term,
+    TypeConversion,
+    TypeDeclaration,
+    TypeDefinition,
+    TypeMark,
+    UnaryAddingOperator,
+    UnconstrainedArrayDefinition,
+    Variant,
+    VariantPart,
+};
+
+
+
+//
+// -- The descriptor of a production, in the order of the ids
+//    -------------------------------------------------------
+using ProdDesc_t = struct ProdDesc_t {
+    ProdID id;
+    const char *name;
+};
+
+
+inline constexpr ProdDesc_t productions[] = {
+    { ProdID::AccessTypeDefinition,            "access_type_definition" },
+    { ProdID::Aggregate,                       "aggregate" },
+    { ProdID::AggregateMore,                   "aggregate(more)" },
+    { ProdID::Allocator,                       "allocator" },
+    { ProdID::ArrayTypeDefinition,             "array_type_definition" },
+    { ProdID::Attribute,                       "attribute" },
+    { ProdID::AttributeDesignator,             "attribute_designator" },
+    { ProdID::BasicDeclaration,                "basic_declaration" },
+    { ProdID::BasicDeclarativeItem,            "basic_declarative_item" },
+    { ProdID::BinaryAddingOperator,            "binary_adding_operator" },
+    { ProdID::Body,                            "body" },
+    { ProdID::Choice,                          "choice" },
+    { ProdID::ComponentAssociation,            "component_association" },
+    { ProdID::ComponentDeclaration,            "component_declaration" },
+    { ProdID::ComponentList,                   "component_list" },
+    { ProdID::ComponentSubtypeDefinition,      "component_subtype_definition" },
+    { ProdID::ConstrainedArrayDefinitionId,    "constrained_array_definition (id)" },
+    { ProdID::ConstrainedArrayDefinitionList,  "constrained_array_definition (list)" },
+    { ProdID::Constraint,                      "constraint" },
+    { ProdID::DeclarativePart,                 "declarative_part" },
+    { ProdID::DerivedTypeDefinition,           "derived_type_definition" },
+    { ProdID::DiscreteRange,                   "discrete_range" },
+    { ProdID::DiscriminantAssociation,         "disriminant_association" },
+    { ProdID::DiscriminantConstraint,          "discriminant_constraint" },
+    { ProdID::DiscriminantPart,                "disctiminant_part" },
+    { ProdID::DiscriminantSpecification,       "discriminant_specification" },
+    { ProdID::EnumerationLiteral,              "enumeration_literal" },
+    { ProdID::EnumerationLiteralSpecification, "enumeration_literal_specification" },
+    { ProdID::EnumerationTypeDefinition,       "enumeration_type_definition" },
+    { ProdID::Expression,                      "expression" },
+    { ProdID::Factor,                          "factor" },
+    { ProdID::FixedAccuracyDefinition,         "fixed_accuracy_definition" },
+    { ProdID::FixedPointConstraint,            "fixed_point_constraint" },
+    { ProdID::FloatingAccuracyDefinition,      "floating_accuracy_definition" },
+    { ProdID::FloatingPointConstraint,         "floating_point_constraint" },
+    { ProdID::FullTypeDefinition,              "full_type_definition" },
+    { ProdID::IdentifierList,                  "identifier_list" },
+    { ProdID::IncompleteTypeDeclaration,       "incomplete_type_declaration" },
+    { ProdID::IndexConstraint,                 "index_constraint" },
+    { ProdID::IndexSubtypeDefinition,          "index_subtype_definition" },
+    { ProdID::IndexedComponent,                "indexed_component" },
+    { ProdID::IndexedComponentSuffix,          "indexed_component(suffix)" },
+    { ProdID::IntegerTypeDefinition,           "integer_type_definition" },
+    { ProdID::LaterDeclarativeItem,            "later_declarative_item" },
+    { ProdID::MultiplyingOperator,             "multiplying_operator" },
+    { ProdID::NameAttribute,                   "name(attribute)" },
+    { ProdID::NameBase,                        "name(base)" },
+    { ProdID::NameExpr,                        "name(expr)" },
+    { ProdID::NameIndexOrSelectedComponent,    "name(index_or_selected_component)" },
+    { ProdID::NameNonExpr,                     "name(non-expr)" },
+    { ProdID::NamePostfix,                     "name(postfix)" },
+    { ProdID::NumberDeclaration,               "number_declaration" },
+    { ProdID::ObjectDeclaration,               "object_declaration" },
+    { ProdID::Prefix,                          "prefix" },
+    { ProdID::Primary,                         "primary" },
+    { ProdID::ProperBody,                      "proper_body" },
+    { ProdID::QualifiedExpression,             "qualified_expression" },
+    { ProdID::Range,                           "range" },
+    { ProdID::RangeConstraint,                 "range_constraint" },
+    { ProdID::RealTypeDefinition,              "real_type_definition" },
+    { ProdID::RecordTypeDefinition,            "record_type_definition" },
+    { ProdID::Relation,                        "relation" },
+    { ProdID::RelationalOperator,              "relational_operator" },
+    { ProdID::SelectedComponent,               "selected_component" },
+    { ProdID::SelectedComponentSuffix,         "selected_component(suffix)" },
+    { ProdID::Selector,                        "selector" },
+    { ProdID::SimpleExpression,                "simple_expression" },
+    { ProdID::SimpleName,                      "simple_name" },
+    { ProdID::Slice,                           "slice" },
+    { ProdID::SliceSuffix,                     "slice(suffix)" },
+    { ProdID::SubtypeDeclaration,              "subtype_declaration" },
+    { ProdID::SubtypeIndication,               "subtype_indication" },
+    { ProdID::Term,                            "term" },
+    { ProdID::TypeConversion,                  "type_conversion" },
+    { ProdID::TypeDeclaration,                 "type_declaration" },
+    { ProdID::TypeDefinition,                  "type_definition" },
+    { ProdID::TypeMark,                        "type_mark" },
+    { ProdID::UnaryAddingOperator,             "unary_adding_operator" },
+    { ProdID::UnconstrainedArrayDefinition,    "unconstrained_array_definition" },
+    { ProdID::Variant,                         "variant" },
+    { ProdID::VariantPart,                     "variant_part" },
+};
+
+
+
+//
+// -- Check that every descriptor is in the slot of its id
+//    ----------------------------------------------------
+constexpr bool ProductionsInOrder(void)
+{
+    for (size_t i = 0; i < std::size(productions); i ++) {
+        if ((size_t)productions[i].id != i) return false;
+    }
+
+    return true;
+}
+
+
+static_assert(ProductionsInOrder(), "the production descriptors are out of order");
+
+
+
+//
+// -- The name of a production
+//    ------------------------
+inline const char *ProductionName(ProdID id) { return productions[(size_t)id].name; }
+
@@ -0,0 +1,75 @@
+//=================================================================================================================
+//  profile.hh -- This header defines the per-production profile of the parser (`--parse-profile`)
+//
+//        Copyright (c)  2025-2026 -- Adam Clark; See LICENSE.md
+//
+//  For each production the profile counts how often it was tried and whether it took any tokens, and
+//  what was thrown away inside it: the tokens rewound and the diagnostics rolled back when a mark gave
+//  up.  The waste is charged to the innermost production open when the rollback happened, which is the
+//  production whose mark it was.
+//
+//  Time is kept inclusive (once per outermost entry, so a recursive production is not counted twice)
+//  and exclusive (less the time spent in the productions it entered).
+//
+// ---------------------------------------------------------------------------------------------------------------
+//
+//     Date      Tracker  Version  Pgmr  Description
+//  -----------  -------  -------  ----  -------------------------------------------------------------------------
+//  2026-Oct-17  Initial   0.0.0   ADCL  Initial version
+//
+//=================================================================================================================
+
+
+
+//
+// -- The profile of the productions parsed in one compilation
+//    --------------------------------------------------------
+class ParseProfile {
+    ParseProfile(const ParseProfile &) = delete;
+    ParseProfile &operator=(const ParseProfile &) = delete;
+
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    using Counts_t = struct Counts_t {
+        uint64_t attempts = 0;
+        uint64_t successes = 0;
+        uint64_t failures = 0;
+        uint64_t rewound = 0;                   // -- tokens consumed and then given back
+        uint64_t rolledBack = 0;                // -- diagnostics queued and then thrown away
+        uint64_t inclusive = 0;                 // -- nanoseconds
+        uint64_t exclusive = 0;                 // -- nanoseconds
+        unsigned active = 0;                    // -- how many entries are open, for recursion
+    };
+
+    using Frame_t = struct Frame_t {
+        ProdID id;
+        Clock::time_point start;
+        uint64_t children;
+    };
+
+
+private:
+    Counts_t counts[std::size(productions)];
+    std::vector<Frame_t> open;
+
+
+public:
+    ParseProfile(void) {}
+
+
+public:
+    void Enter(ProdID id);
+    void Leave(bool took);
+    void Rewound(int toks, size_t msgs) {
+        if (open.empty()) return;
+        Counts_t &c = counts[(size_t)open.back().id];
+        c.rewound += toks;
+        c.rolledBack += msgs;
+    }
+    void Print(void) const;
+    bool Json(const std::string &path) const;
+};
+
+
@@ -21,22 +21,42 @@ class ScopeManager {
     ScopeManager(const ScopeManager &) = delete;
     ScopeManager &operator=(const ScopeManager &) = delete;
     friend class Parser;
+    friend class Journal;
 
 
 private:
     std::vector<std::unique_ptr<Scope>> stack;
     Scope *current = nullptr;
+    Journal *journal = nullptr;
+
+
+    //
+    // -- Each state of the symbol table has its own epoch, so that results worked out from it can be
+    //    kept for as long as it lasts.  Every change moves to a new epoch; a rollback returns to the
+    //    epoch it rolled back to, unless a change the journal cannot undo has happened since (`floor`).
+    //    --------------------------------------------------------------------------------------------
+    uint64_t epoch = 0;
+    uint64_t lastEpoch = 0;
+    uint64_t floor = 0;
 
 
 private:
     // -- these are only accessible from Parser
     void PushScope(Scope::ScopeKind kind, std::string name);
     void PopScope(void);
+    void Changed(void) { epoch = ++ lastEpoch; }
+    void Restore(uint64_t e) { if (e >= floor) epoch = e; else Changed(); }
+    void Declared(Scope *scope);
 
 
 public:
     template <typename T>
-    T *Declare(std::unique_ptr<T> sym) { return CurrentScope()->Declare(std::move(sym)); }
+    T *Declare(std::unique_ptr<T> sym) {
+        Declared(CurrentScope());
+        return CurrentScope()->Declare(std::move(sym));
+    }
+    void Retire(Symbol *sym);
+    uint64_t Epoch(void) const { return epoch; }
 
 
 public:
@@ -44,14 +64,16 @@ public:
 
 
 public:
-    const std::vector<Symbol *> *Lookup(std::string_view name) const;
+    const std::vector<Symbol *> *Lookup(Atom_t name) const;
     Scope *CurrentScope(void) const { return stack[stack.size() - 1].get(); }
-    bool IsLocalDefined(std::string_view name) const { return CurrentScope()->LocalLookup(name) != nullptr; }
+    bool IsLocalDefined(Atom_t name) const { return CurrentScope()->LocalLookup(name) != nullptr; }
     void Print(void) const;
     std::unique_ptr<Scope> Claim(void) {
         std::unique_ptr<Scope> rv = std::move(stack.back());
         stack.pop_back();
         current = rv->Parent();
+        Changed();
+        floor = epoch;
         return std::move(rv);
     }
 };
@@ -52,7 +52,7 @@ private:
     //    to each possible symbol in the scope.  `std::vector<Symbol *>` is a vector of symbols,
     //    not types.
     //    ---------------------------------------------------------------------------------------
-    std::unordered_map<std::string, std::vector<Symbol *>> index;
+    std::unordered_map<Atom_t, std::vector<Symbol *>> index;
 
 
 public:
@@ -62,11 +62,9 @@ public:
     Scope *Parent(void) const { return parent; }
     ScopeKind GetKind(void) const { return kind; }
 
-    size_t Checkpoint(void) { return ordered.size(); }
-
-    void Rollback(size_t cp);
-    std::vector<Symbol *> *LocalLookup(std::string_view name);
-    void AddType(const std::string name, TypeSymbol *type) { index.find(name)->second.push_back(type); };
+    void Undeclare(void);
+    std::vector<Symbol *> *LocalLookup(Atom_t name);
+    void AddType(Atom_t name, TypeSymbol *type) { index.find(name)->second.push_back(type); };
     void Print(void) const;
 
 
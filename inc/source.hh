@@ -0,0 +1,62 @@
+//=================================================================================================================
+//  source.hh -- This header defines a source file which has been loaded into memory
+//
+//        Copyright (c)  2025-2026 -- Adam Clark; See LICENSE.md
+//
+//  The source file is mapped into memory once.  The scanner works directly from the mapped buffer and the
+//  source lines for listings and diagnostics are served from an index of line starting offsets.  Therefore,
+//  there is no copy of the source text held anywhere else in the compiler.
+//
+// ---------------------------------------------------------------------------------------------------------------
+//
+//     Date      Tracker  Version  Pgmr  Description
+//  -----------  -------  -------  ----  -------------------------------------------------------------------------
+//  2026-Oct-17  Initial   0.0.0   ADCL  Initial version
+//
+//=================================================================================================================
+
+
+
+//
+// -- This is a source file loaded into memory with its line index
+//    ------------------------------------------------------------
+class SourceFile {
+    SourceFile(void) = delete;
+    SourceFile(const SourceFile &) = delete;
+    SourceFile &operator=(const SourceFile &) = delete;
+
+
+private:
+    std::string name;
+    char *base;                     // -- the source text followed by 2 NUL bytes (required by flex)
+    size_t size;                    // -- the size of the source text, not including the NUL bytes
+    size_t mapped;                  // -- the size of the memory mapping; 0 when `base` is on the heap
+    std::vector<char> heap;         // -- used only when the source cannot be mapped (stdin)
+    std::vector<size_t> lines;      // -- the offset of the first character of each line
+    bool valid;
+
+
+public:
+    explicit SourceFile(const char *fn);
+    virtual ~SourceFile();
+
+
+private:
+    void Slurp(FILE *fp);
+    void IndexLines(void);
+
+
+public:
+    const std::string &Name(void) const { return name; }
+    char *Buffer(void) const { return base; }
+    size_t Size(void) const { return size; }
+    size_t BufferSize(void) const { return size + 2; }
+    bool Valid(void) const { return valid; }
+    size_t LineCount(void) const { return lines.size(); }
+    std::string_view Line(size_t l) const;
+    size_t LineOf(size_t offset) const;
+    void Replace(size_t offset, size_t removed, std::string_view text);
+    std::string_view Text(size_t offset, size_t length) const { return std::string_view(base + offset, length); }
+};
+
+
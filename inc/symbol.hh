@@ -49,7 +49,7 @@ public:
 
 public:
     // -- common apptributes for all symbols
-    std::string name;
+    Atom_t name;
     SymbolKind kind;
     SourceLoc_t loc;
 
@@ -63,7 +63,7 @@ public:
 
 
 public:
-    Symbol(std::string n, SymbolKind k, SourceLoc_t l, Scope *d) : name(n), kind(k), loc(l), declScope(d) {}
+    Symbol(Atom_t n, SymbolKind k, SourceLoc_t l, Scope *d) : name(n), kind(k), loc(l), declScope(d) {}
     virtual ~Symbol() = default;
 
 
@@ -141,7 +141,7 @@ public:
 
 protected:
     // -- cannot create a new type directly -- must be a subclass
-    TypeSymbol(std::string n, TypeCategory c, SourceLoc_t l, Scope *d)
+    TypeSymbol(Atom_t n, TypeCategory c, SourceLoc_t l, Scope *d)
             : Symbol(n, SymbolKind::Type, l, d), category(c) {}
 };
 
@@ -162,7 +162,7 @@ public:
 
 
 public:
-    EnumTypeSymbol(std::string n, SourceLoc_t l, Scope *d) : TypeSymbol(n, TypeCategory::Enumeration, l, d) {}
+    EnumTypeSymbol(Atom_t n, SourceLoc_t l, Scope *d) : TypeSymbol(n, TypeCategory::Enumeration, l, d) {}
 
 
 public:
@@ -188,7 +188,7 @@ public:
 
 
 public:
-    RecordTypeSymbol(std::string n, SourceLoc_t l, Scope *d) : TypeSymbol(n, TypeCategory::Record, l, d) {}
+    RecordTypeSymbol(Atom_t n, SourceLoc_t l, Scope *d) : TypeSymbol(n, TypeCategory::Record, l, d) {}
 
 
 public:
@@ -209,7 +209,7 @@ class DerivedTypeSymbol : public TypeSymbol {
 
 
 public:
-    DerivedTypeSymbol(std::string n, SourceLoc_t l, Scope *d) : TypeSymbol(n, TypeCategory::Derived, l, d) {}
+    DerivedTypeSymbol(Atom_t n, SourceLoc_t l, Scope *d) : TypeSymbol(n, TypeCategory::Derived, l, d) {}
 
 
 public:
@@ -230,7 +230,7 @@ class AccessTypeSymbol : public TypeSymbol {
 
 
 public:
-    AccessTypeSymbol(std::string n, SourceLoc_t l, Scope *d) : TypeSymbol(n, TypeCategory::Access, l, d) {}
+    AccessTypeSymbol(Atom_t n, SourceLoc_t l, Scope *d) : TypeSymbol(n, TypeCategory::Access, l, d) {}
 
 
 public:
@@ -251,7 +251,7 @@ class IntegerTypeSymbol : public TypeSymbol {
 
 
 public:
-    IntegerTypeSymbol(std::string n, SourceLoc_t l, Scope *d) : TypeSymbol(n, TypeCategory::Integer, l, d) {}
+    IntegerTypeSymbol(Atom_t n, SourceLoc_t l, Scope *d) : TypeSymbol(n, TypeCategory::Integer, l, d) {}
 
 
 public:
@@ -272,7 +272,7 @@ class RealTypeSymbol : public TypeSymbol {
 
 
 public:
-    RealTypeSymbol(std::string n, SourceLoc_t l, Scope *d) : TypeSymbol(n, TypeCategory::Real, l, d) {}
+    RealTypeSymbol(Atom_t n, SourceLoc_t l, Scope *d) : TypeSymbol(n, TypeCategory::Real, l, d) {}
 
 
 public:
@@ -293,7 +293,7 @@ class ArrayTypeSymbol : public TypeSymbol {
 
 
 public:
-    ArrayTypeSymbol(std::string n, SourceLoc_t l, Scope *d) : TypeSymbol(n, TypeCategory::Array, l, d) {}
+    ArrayTypeSymbol(Atom_t n, SourceLoc_t l, Scope *d) : TypeSymbol(n, TypeCategory::Array, l, d) {}
 
 
 public:
@@ -314,7 +314,7 @@ class SubtypeSymbol : public TypeSymbol {
 
 
 public:
-    SubtypeSymbol(std::string n, SourceLoc_t l, Scope *d) : TypeSymbol(n, TypeCategory::Subtype, l, d) {}
+    SubtypeSymbol(Atom_t n, SourceLoc_t l, Scope *d) : TypeSymbol(n, TypeCategory::Subtype, l, d) {}
 
 
 public:
@@ -335,7 +335,7 @@ class IncompleteTypeSymbol : public TypeSymbol {
 
 
 public:
-    IncompleteTypeSymbol(std::string n, SourceLoc_t l, Scope *d) : TypeSymbol(n, TypeCategory::Incomplete, l, d) {
+    IncompleteTypeSymbol(Atom_t n, SourceLoc_t l, Scope *d) : TypeSymbol(n, TypeCategory::Incomplete, l, d) {
         kind = SymbolKind::IncompleteType;
     }
 
@@ -363,7 +363,7 @@ public:
 
 
 public:
-    EnumLiteralSymbol(std::string n, EnumTypeSymbol *p, size_t o, SourceLoc_t l, Scope *d)
+    EnumLiteralSymbol(Atom_t n, EnumTypeSymbol *p, size_t o, SourceLoc_t l, Scope *d)
             : Symbol(n, SymbolKind::EnumLiteral, l, d), parentType(p), ordinal(o)
     {
         type = parentType;
@@ -388,7 +388,7 @@ class DiscriminantSymbol : public Symbol {
 
 
 public:
-    DiscriminantSymbol(std::string n, SourceLoc_t l, Scope *d) : Symbol(n, SymbolKind::Discriminant, l, d) {}
+    DiscriminantSymbol(Atom_t n, SourceLoc_t l, Scope *d) : Symbol(n, SymbolKind::Discriminant, l, d) {}
 
 
 public:
@@ -409,7 +409,7 @@ class AttributeSymbol : public Symbol {
 
 
 public:
-    AttributeSymbol(std::string n, SourceLoc_t l, Scope *d) : Symbol(n, SymbolKind::Attribute, l, d) {}
+    AttributeSymbol(Atom_t n, SourceLoc_t l, Scope *d) : Symbol(n, SymbolKind::Attribute, l, d) {}
 
 
 public:
@@ -430,7 +430,7 @@ class ObjectSymbol : public Symbol {
 
 
 public:
-    ObjectSymbol(std::string n, SourceLoc_t l, Scope *d) : Symbol(n, SymbolKind::Object, l, d) {}
+    ObjectSymbol(Atom_t n, SourceLoc_t l, Scope *d) : Symbol(n, SymbolKind::Object, l, d) {}
 
 
 public:
@@ -451,7 +451,7 @@ class ComponentSymbol : public Symbol {
 
 
 public:
-    ComponentSymbol(std::string n, SourceLoc_t l, Scope *d) : Symbol(n, SymbolKind::Component, l, d) {}
+    ComponentSymbol(Atom_t n, SourceLoc_t l, Scope *d) : Symbol(n, SymbolKind::Component, l, d) {}
 
 
 public:
@@ -0,0 +1,38 @@
+//=================================================================================================================
+//  token-cache.hh -- This header defines the on-disk cache of token streams
+//
+//        Copyright (c)  2025-2026 -- Adam Clark; See LICENSE.md
+//
+//  When a cache directory is given, each token stream is saved as a binary image named for a hash of the
+//  source text and of the compiler build.  A later run over the same text maps that image and loads the
+//  token arrays from it instead of lexing.  The identifier spellings and literal values are saved along
+//  with the tokens, and are interned and pooled again on loading since atoms and pool indexes are only
+//  good for the run which made them.
+//
+// ---------------------------------------------------------------------------------------------------------------
+//
+//     Date      Tracker  Version  Pgmr  Description
+//  -----------  -------  -------  ----  -------------------------------------------------------------------------
+//  2026-Oct-17  Initial   0.0.0   ADCL  Initial version
+//
+//=================================================================================================================
+
+
+
+//
+// -- The token cache; all of the work is done on a token stream, so there is nothing to construct
+//    --------------------------------------------------------------------------------------------
+class TokenCache {
+    TokenCache(void) = delete;
+
+
+private:
+    static uint64_t Key(const SourceFile &source);
+    static std::string Path(const std::string &dir, uint64_t key);
+
+
+public:
+    static bool Load(TokenStream &ts, const std::string &dir);
+    static void Save(const TokenStream &ts, const std::string &dir);
+};
+
@@ -14,9 +14,10 @@
 
 
 //
-// -- These are the tokens which will be used in scanning and parsing
-//    ---------------------------------------------------------------
-enum class TokenType {
+// -- These are the tokens which will be used in scanning and parsing; they are stored as
+//    16-bit values to keep the token stream dense
+//    -----------------------------------------------------------------------------------
+enum class TokenType : uint16_t {
     YYEOF = 0,                              /* "end of file"  */
     YYUNDEF = 257,                          /* "invalid token"  */
     TOK_QUOTATION = 258,                    /* TOK_QUOTATION  */
@@ -144,20 +145,44 @@ enum class TokenType {
 
 
 //
-// -- Define what a character literal will look like passed from the lexer to the parser
-//    ----------------------------------------------------------------------------------
+// -- Define what a character literal will look like passed from the lexer to the parser; the offset is
+//    that of the opening apostrophe in the source, and the lexeme is always 3 characters long
+//    --------------------------------------------------------------------------------------------------
 struct CharLiteral {
-    std::string lexeme;
+    uint32_t offset;
     int value;
 };
 
 
 
+//
+// -- Define what a string literal will look like passed from the lexer to the parser.  This is a view
+//    of the text between the quotes in the source; when `escaped` is set, the text contains doubled
+//    quotes (`""`) which each stand for a single quote in the value.
+//    ------------------------------------------------------------------------------------------------
+struct StringLiteral {
+    uint32_t offset;
+    uint32_t length;
+    bool escaped;
+};
+
+
+
 //
 // -- Define what an identifier will look like passed from the lexer to the parser
 //    ----------------------------------------------------------------------------
 struct IdentifierLexeme {
-    std::string name;
+    Atom_t name;
+};
+
+
+
+//
+// -- Define what a numeric literal will look like passed from the lexer to the parser; the index is into
+//    the integer or the real table of the `LiteralPool`, depending on the token type
+//    ----------------------------------------------------------------------------------------------------
+struct NumericLiteral {
+    uint32_t index;
 };
 
 
@@ -168,11 +193,24 @@ struct IdentifierLexeme {
 using YYSTYPE = std::variant<
     std::monostate,             // empty token payload
     struct CharLiteral,         // a character literal
-    struct IdentifierLexeme     // identifier
+    struct StringLiteral,       // a string literal
+    struct IdentifierLexeme,    // identifier
+    struct NumericLiteral       // universal integer or real literal
 >;
 
 
-extern YYSTYPE yylval;
+
+//
+// -- This is the state of one flex scan.  Each scanner carries its own, so several sources can be
+//    scanned at the same time on different threads.
+//    --------------------------------------------------------------------------------------------
+using ScanContext_t = struct ScanContext_t {
+    const char *base;               // -- the start of the buffer, for literal offsets
+    uint32_t column;                // -- the scanner column after the last token
+    uint32_t strStart;              // -- the offset of the string literal being scanned
+    bool strEscaped;                // -- the string literal contains a doubled quote
+    YYSTYPE payload;                // -- the payload of the last token
+};
 
 
 
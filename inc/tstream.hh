@@ -21,9 +21,21 @@
 
 
 //
-// -- This structure is the location of the token in the source file
-//    --------------------------------------------------------------
+// -- This is a compact handle on the location of a token in the source.  Each token stream is given
+//    its own range of handles, one per byte of its source, so the handle finds both the stream and
+//    the offset of the token.  It is only expanded into a file, line, column and text when a
+//    diagnostic is reported.  Handle 0 is no location at all.
+//    ---------------------------------------------------------------------------------------------
 using SourceLoc_t = struct SourceLoc_t {
+    uint32_t handle = 0;
+};
+
+
+
+//
+// -- This is a source location expanded for a diagnostic message
+//    -----------------------------------------------------------
+using ExpandedLoc_t = struct ExpandedLoc_t {
     std::string filename;
     long line;
     int col;
@@ -34,30 +46,96 @@ using SourceLoc_t = struct SourceLoc_t {
 
 
 //
-// -- This is the stream of tokens organized as a vector table so the parser can look ahead
-//    -------------------------------------------------------------------------------------
+// -- This is the range of tokens changed by an edit: `removed` tokens starting at `from` were replaced
+//    by `inserted` new ones, and the tokens after them were moved along
+//    -------------------------------------------------------------------------------------------------
+using TokenEdit_t = struct TokenEdit_t {
+    int from;
+    int removed;
+    int inserted;
+};
+
+
+
+//
+// -- This is the stream of tokens organized as a vector table so the parser can look ahead.  The
+//    tokens are kept as a structure of arrays: the token kinds are in one dense array (which is
+//    what the parser walks), their positions in a second and the few payloads which exist in a
+//    side table.
+//
+//    Normally the whole file is lexed up front.  When streaming, tokens are lexed only as the
+//    parser asks for them, and the tokens before the oldest live mark (which nothing can reset
+//    back to) are dropped from the front of the arrays.  So the arrays hold only the window
+//    from the oldest mark to the furthest lookahead, and `first` is the location of the token
+//    at the front of them.
+//    ------------------------------------------------------------------------------------------
 class TokenStream {
+    friend class TokenCache;
+
 private:
-    using Token = struct Token {
-    public:
-        std::string &filename;
-        int yylineno;
-        int column;
-        TokenType tok;
-        YYSTYPE payload;
-
-    public:
-        Token(std::string &f, int l, int c, TokenType t, YYSTYPE &p)
-                : filename(f), yylineno(l), column(c), tok(t), payload(p) {}
+    using TokenPos = struct TokenPos {
+        uint32_t offset;                // -- byte offset of the token in the source
+        uint32_t line;                  // -- the line number (0-based, as counted by the scanner)
+        uint32_t column;                // -- the scanner column after the token
+        uint32_t payload;               // -- index into `payloads`; 0 is the empty payload
+    };
+
+    // -- the tokens lexed from one window of the source when it is lexed in chunks
+    using Chunk_t = struct Chunk_t {
+        uint32_t from;
+        uint32_t to;
+        std::vector<TokenType> kinds;
+        std::vector<TokenPos> positions;
+        std::vector<YYSTYPE> payloads;  // -- only for the tokens which carry one
+        uint32_t lines;                 // -- the line feeds in the window
+        bool boundary;                  // -- the window ended with the lexer at a boundary
     };
 
 
 private:
-    std::vector<Token *> tokStream;
+    std::vector<TokenType> kinds;
+    std::vector<TokenPos> positions;
+    std::vector<YYSTYPE> payloads;
     int loc;
+    int first;
     std::string filename;
-    std::vector<std::string> source;
-    bool sourceValid;
+    SourceFile source;
+    uint32_t base;                  // -- the handle of the first byte of the source
+    uint32_t handles;               // -- the number of handles in the range from `base`
+
+
+    //
+    // -- the state used only when streaming
+    //    ----------------------------------
+    bool streaming;
+    std::unique_ptr<Lexer> lexer;   // -- released once the EOF has been lexed
+    std::vector<int> marks;         // -- the locations saved by the live marks, oldest first
+    bool held;                      // -- a token was lexed ahead looking for `and then` or `or else`
+    TokenType heldTok;
+    TokenPos heldPos;
+    YYSTYPE heldPayload;
+
+
+public:
+    static bool HasPayload(TokenType tok) {
+        return tok == TokenType::TOK_IDENTIFIER || tok == TokenType::TOK_CHARACTER_LITERAL
+                || tok == TokenType::TOK_STRING_LITERAL
+                || tok == TokenType::TOK_UNIVERSAL_INT_LITERAL || tok == TokenType::TOK_UNIVERSAL_REAL_LITERAL;
+    }
+
+
+private:
+    void Append(TokenType tok, const TokenPos &pos, const YYSTYPE &payload);
+    void Lex(Lexer::Kind kind);
+    void LexChunked(Lexer::Kind kind, unsigned jobs);
+    static void LexChunk(Lexer::Kind kind, const SourceFile &source, Chunk_t &chunk);
+    static bool Settled(TokenType tok);
+    void Fill(int n);
+    void LexOne(void);
+    void Release(void);
+    void Want(int n) { if (n - first >= (int)kinds.size()) Fill(n); }
+    void Register(void);
+    ExpandedLoc_t ExpandOffset(uint32_t offset) const;
 
 
 public:
@@ -65,29 +143,33 @@ public:
 
 public:
     TokenStream(const char *fn);
+    ~TokenStream();
 
 public:
     void Advance(int n = 1) { loc += n; }
-    TokenType Current(void) const { return tokStream[loc]->tok; }
-    YYSTYPE &Payload(void) const { return tokStream[loc]->payload; }
-    TokenType Peek(int n = 1) { return tokStream[loc + n]->tok; }
+    TokenType Current(void) { Want(loc); return kinds[loc - first]; }
+    const YYSTYPE &Payload(void) { Want(loc); return payloads[positions[loc - first].payload]; }
+    TokenType Peek(int n = 1) { Want(loc + n); return kinds[loc + n - first]; }
     std::string FileName(void) const { return filename; }
-    long LineNo(void) const { return tokStream[loc]->yylineno; }
-    int Column(void) const { return tokStream[loc]->column; }
-    std::string SourceLine(void) const { return source[LineNo()]; }
+    long LineNo(void) { Want(loc); return positions[loc - first].line; }
+    int Column(void) { Want(loc); return positions[loc - first].column; }
+    size_t Offset(void) { Want(loc); return positions[loc - first].offset; }
+    std::string SourceLine(void) { return std::string(source.Line(LineNo())); }
+    std::string_view Text(uint32_t offset, uint32_t length) const { return source.Text(offset, length); }
+    std::string StringValue(const StringLiteral &s) const { return StringValue(Text(s.offset, s.length), s.escaped); }
+    static std::string StringValue(std::string_view text, bool escaped);
     void Recovery(TokenType t = TokenType::TOK_SEMICOLON);
-    void Reset(int nLoc) { loc = nLoc; }
+    TokenEdit_t Edit(uint32_t offset, uint32_t removed, std::string_view text);
+    void Reset(int nLoc) { assert(nLoc >= first); loc = nLoc; }
     int Location(void) const { return loc; }
+    int Mark(void) { marks.push_back(loc); return loc; }
+    void Unmark(void) { marks.pop_back(); }
+    size_t Count(void) const { return first + kinds.size(); }
     void Listing(void);
     void List(void);
-    SourceLoc_t SourceLocation(void);
-    static SourceLoc_t EmptyLocation(void);
-
-
-public:
-//    std::string &GetErrMsg(void) const { return *(tokStream[loc]->payload.errMsg); }
+    SourceLoc_t SourceLocation(void) { Want(loc); return SourceLoc_t { base + positions[loc - first].offset }; }
+    static SourceLoc_t EmptyLocation(void) { return SourceLoc_t {}; }
+    static ExpandedLoc_t Expand(SourceLoc_t where);
 };
 
 
-
-
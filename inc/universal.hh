@@ -0,0 +1,161 @@
+//=================================================================================================================
+//  universal.hh -- This header defines the universal numeric types and the literal pool
+//
+//        Copyright (c)  2025-2026 -- Adam Clark; See LICENSE.md
+//
+//  Ada numeric literals are values of the universal types and static expressions over them are evaluated
+//  exactly.  So, `BigInt` is an arbitrary-precision integer and `Rational` is an exact (always normalized)
+//  fraction of 2 `BigInt`s.  Each numeric literal is decoded once by the scanner into the `LiteralPool` and
+//  the token carries only the index of the value in the pool.
+//
+// ---------------------------------------------------------------------------------------------------------------
+//
+//     Date      Tracker  Version  Pgmr  Description
+//  -----------  -------  -------  ----  -------------------------------------------------------------------------
+//  2026-Oct-17  Initial   0.0.0   ADCL  Initial version
+//
+//=================================================================================================================
+
+
+
+//
+// -- An arbitrary-precision signed integer; the magnitude is stored in 32-bit limbs, least significant first
+//    -------------------------------------------------------------------------------------------------------
+class BigInt {
+private:
+    std::vector<uint32_t> mag;      // -- no leading zero limbs; zero is the empty vector
+    bool neg = false;               // -- never set for zero
+
+
+public:
+    BigInt(void) = default;
+    BigInt(int64_t v);
+    BigInt(std::vector<uint32_t> limbs, bool negative) : mag(std::move(limbs)), neg(negative) { Trim(); }
+
+
+private:
+    void Trim(void);
+    static int CompareMag(const BigInt &a, const BigInt &b);
+    static void AddMag(BigInt &r, const BigInt &a, const BigInt &b);
+    static void SubMag(BigInt &r, const BigInt &a, const BigInt &b);      // -- requires |a| >= |b|
+
+
+public:
+    bool IsZero(void) const { return mag.empty(); }
+    bool IsNegative(void) const { return neg; }
+    bool IsOdd(void) const { return !mag.empty() && (mag[0] & 1); }
+    const std::vector<uint32_t> &Limbs(void) const { return mag; }
+
+    void MulSmall(uint32_t m);
+    void AddSmall(uint32_t a);
+    uint32_t DivSmall(uint32_t d);          // -- divides the magnitude in place; returns the remainder
+
+    static int Compare(const BigInt &a, const BigInt &b);
+    static void DivMod(const BigInt &a, const BigInt &b, BigInt &q, BigInt &r);
+    static BigInt Gcd(BigInt a, BigInt b);
+    static BigInt Pow(uint32_t base, uint32_t exp);
+
+    BigInt operator-(void) const { BigInt r = *this; if (!r.IsZero()) r.neg = !r.neg; return r; }
+    BigInt Abs(void) const { BigInt r = *this; r.neg = false; return r; }
+
+    friend BigInt operator+(const BigInt &a, const BigInt &b);
+    friend BigInt operator-(const BigInt &a, const BigInt &b);
+    friend BigInt operator*(const BigInt &a, const BigInt &b);
+    friend BigInt operator/(const BigInt &a, const BigInt &b) { BigInt q, r; DivMod(a, b, q, r); return q; }
+    friend BigInt operator%(const BigInt &a, const BigInt &b) { BigInt q, r; DivMod(a, b, q, r); return r; }
+
+    friend bool operator==(const BigInt &a, const BigInt &b) { return Compare(a, b) == 0; }
+    friend bool operator!=(const BigInt &a, const BigInt &b) { return Compare(a, b) != 0; }
+    friend bool operator<(const BigInt &a, const BigInt &b) { return Compare(a, b) < 0; }
+    friend bool operator<=(const BigInt &a, const BigInt &b) { return Compare(a, b) <= 0; }
+    friend bool operator>(const BigInt &a, const BigInt &b) { return Compare(a, b) > 0; }
+    friend bool operator>=(const BigInt &a, const BigInt &b) { return Compare(a, b) >= 0; }
+
+    std::string ToString(void) const;
+};
+
+
+
+//
+// -- An exact rational number, kept normalized: the denominator is positive and shares no factor with the numerator
+//    --------------------------------------------------------------------------------------------------------------
+class Rational {
+private:
+    BigInt num;
+    BigInt den = 1;
+
+
+public:
+    Rational(void) = default;
+    Rational(const BigInt &n) : num(n), den(1) {}
+    Rational(const BigInt &n, const BigInt &d);
+
+
+private:
+    void Normalize(void);
+
+
+public:
+    const BigInt &Numerator(void) const { return num; }
+    const BigInt &Denominator(void) const { return den; }
+    bool IsInteger(void) const { return den == BigInt(1); }
+
+    static int Compare(const Rational &a, const Rational &b);
+
+    Rational operator-(void) const { return Rational(-num, den); }
+
+    friend Rational operator+(const Rational &a, const Rational &b) { return Rational(a.num * b.den + b.num * a.den, a.den * b.den); }
+    friend Rational operator-(const Rational &a, const Rational &b) { return Rational(a.num * b.den - b.num * a.den, a.den * b.den); }
+    friend Rational operator*(const Rational &a, const Rational &b) { return Rational(a.num * b.num, a.den * b.den); }
+    friend Rational operator/(const Rational &a, const Rational &b) { return Rational(a.num * b.den, a.den * b.num); }
+
+    friend bool operator==(const Rational &a, const Rational &b) { return Compare(a, b) == 0; }
+    friend bool operator!=(const Rational &a, const Rational &b) { return Compare(a, b) != 0; }
+    friend bool operator<(const Rational &a, const Rational &b) { return Compare(a, b) < 0; }
+    friend bool operator<=(const Rational &a, const Rational &b) { return Compare(a, b) <= 0; }
+    friend bool operator>(const Rational &a, const Rational &b) { return Compare(a, b) > 0; }
+    friend bool operator>=(const Rational &a, const Rational &b) { return Compare(a, b) >= 0; }
+
+    std::string ToString(void) const;
+};
+
+
+
+//
+// -- The pool of decoded numeric literals for the compilation.  Integer literals and real literals are kept
+//    in separate tables; the token type tells which table the index of the payload refers to.  The pool is
+//    shared by the scanners on all threads, so the tables are guarded by a lock.  They are deques so that
+//    a reference to a value stays good while other threads add to them.
+//    ------------------------------------------------------------------------------------------------------
+class LiteralPool {
+    LiteralPool(const LiteralPool &) = delete;
+    LiteralPool &operator=(const LiteralPool &) = delete;
+
+
+private:
+    std::deque<BigInt> integers;
+    std::deque<Rational> reals;
+    mutable std::mutex lock;
+
+
+public:
+    LiteralPool(void) = default;
+
+
+private:
+    static Rational Decode(const char *text, size_t len);
+
+
+public:
+    uint32_t AddInteger(const char *text, size_t len);
+    uint32_t AddReal(const char *text, size_t len);
+    uint32_t AddInteger(const BigInt &v);
+    uint32_t AddReal(const Rational &v);
+
+    const BigInt &Integer(uint32_t idx) const { std::lock_guard<std::mutex> g(lock); return integers[idx]; }
+    const Rational &Real(uint32_t idx) const { std::lock_guard<std::mutex> g(lock); return reals[idx]; }
+};
+
+
+extern LiteralPool literals;
+
@@ -0,0 +1,68 @@
+#!/usr/bin/env bash
+#
+#  gen-adversarial.sh -- write Ada declarations built to make the parser back up as much as it can
+#
+#  usage: gen-adversarial.sh family depth [count]
+#
+#  Each family nests one construct `depth` deep, where every level can only be told apart from its
+#  alternatives once the level inside it has been parsed.  The result is `count` number declarations
+#  (200 by default) with the same initial value, so that the time to parse them is well above the
+#  time to start the compiler.  Parse them with `types`.
+#
+#  families:
+#      paren       ((((1))))                       -- primary: ( expression )
+#      operators   (1 + (1 * (1 - 1)))             -- primary: ( expression ) under each operator
+#      aggregate   (1, (1, (1, (1, 2))))           -- primary: expression first, then aggregate
+#      named       (1 | 2 => (1 | 2 => 0))         -- choice: expression, then range, then others
+#      index       A(A(A(1)))                      -- name(postfix): indexed component or slice
+#      slice       A(A(A(1 .. 2) .. 2) .. 2)       -- name(postfix): slice after indexed component fails
+#      mixed       A((A((1) + 1)) + 1)             -- names and parentheses inside one another
+#
+
+set -u   # undefined variables are errors
+
+if [ $# -lt 2 ]; then
+    echo "usage: $0 family depth [count]" >&2
+    exit 1
+fi
+
+FAMILY="$1"
+DEPTH="$2"
+COUNT="${3:-200}"
+
+open=""
+close=""
+
+for ((i = 0; i < DEPTH; i ++)); do
+    case "$FAMILY" in
+    paren)      open+="(";               close+=")" ;;
+    operators)  case $((i % 3)) in
+                0) open+="(1 + " ;;
+                1) open+="(1 * " ;;
+                2) open+="(1 - " ;;
+                esac
+                close+=")" ;;
+    aggregate)  open+="(1, ";            close+=")" ;;
+    named)      open+="(1 | 2 => ";      close+=")" ;;
+    index)      open+="A(";              close+=")" ;;
+    slice)      open+="A(";              close+=" .. 2)" ;;
+    mixed)      open+="A((";             close+=") + 1)" ;;
+    *)
+        echo "$0: unknown family '$FAMILY'" >&2
+        exit 1
+        ;;
+    esac
+done
+
+case "$FAMILY" in
+paren|operators|index|mixed)    inner="1" ;;
+aggregate)                      inner="2" ;;
+named)                          inner="0" ;;
+slice)                          inner="1" ;;
+esac
+
+echo "A : INTEGER := 1;"
+
+for ((i = 0; i < COUNT; i ++)); do
+    echo "X$i : constant := $open$inner$close;"
+done
@@ -17,7 +17,7 @@ for test in "${TESTS[@]}"; do
     name=$(basename "$test")
     printf "[ RUN      ] %s\r" "$name"
 
-    if "$COMPILER" expr "$test" > /dev/null 2>&1 ; then
+    if "$COMPILER" expr "$test" > /dev/null 2>&1 && "$COMPILER" --packrat expr "$test" > /dev/null 2>&1 ; then
         printf "[       OK ] %s\n" "$name"
     else
         printf "[  FAILED  ] %s\n" "$name"
@@ -0,0 +1,53 @@
+#!/usr/bin/env bash
+
+set -u   # undefined variables are errors
+
+TESTS=(tst/*/*.ada)
+
+COMPILER="./bin/ada-cc"
+
+CACHE="$(mktemp -d)"
+trap 'rm -rf "$CACHE"' EXIT
+
+failures=0
+total=0
+
+echo "Comparing lexers on ${#TESTS[@]} files"
+echo
+
+for test in "${TESTS[@]}"; do
+    name="${test#tst/}"
+    printf "[ RUN      ] %s\r" "$name"
+
+    # -- the lexers must agree, and lexing in chunks, streaming, loading from the token cache or
+    #    editing in place must give the same stream as lexing in one go
+    "$COMPILER" --token-cache="$CACHE" tokenize "$test" > /dev/null 2>&1
+
+    if "$COMPILER" lexdiff "$test" > /dev/null 2>&1 \
+            && "$COMPILER" editdiff "$test" > /dev/null 2>&1 \
+            && cmp -s <("$COMPILER" tokenize "$test" 2>&1) \
+                      <("$COMPILER" --lex-jobs=4 --chunked-lex-size=0 tokenize "$test" 2>&1) \
+            && cmp -s <("$COMPILER" tokenize "$test" 2>&1) \
+                      <("$COMPILER" --stream-tokens tokenize "$test" 2>&1) \
+            && cmp -s <("$COMPILER" tokenize "$test" 2>&1) \
+                      <("$COMPILER" --token-cache="$CACHE" tokenize "$test" 2>&1) \
+            && cmp -s <("$COMPILER" --lexer=fast tokenize "$test" 2>&1) \
+                      <("$COMPILER" --lexer=fast --lex-jobs=4 --chunked-lex-size=0 tokenize "$test" 2>&1) ; then
+        printf "[       OK ] %s\n" "$name"
+    else
+        printf "[  FAILED  ] %s\n" "$name"
+        failures=$((failures + 1))
+    fi
+
+    total=$((total + 1))
+done
+
+echo
+echo "================================"
+echo "Tests run : $total"
+echo "Failures  : $failures"
+echo "================================"
+
+if [ "$failures" -ne 0 ]; then
+    exit 1
+fi
@@ -0,0 +1,118 @@
+#!/usr/bin/env bash
+#
+#  run-parse-bench.sh -- time the parser on the adversarial families from gen-adversarial.sh at
+#                        growing depths, and fail any family whose parse time grows faster than the
+#                        budget allows
+#
+#  The growth exponent is the slope of log(time) against log(depth), fitted by least squares, where
+#  the time is less the time to parse the same declarations with no nesting at all.  A linear parse
+#  has an exponent of about 1.  A family which times out has failed.
+#
+#  environment:
+#      BUDGET      the largest exponent allowed (default 1.3)
+#      TIMEOUT     seconds allowed for one parse (default 10)
+#      COUNT       declarations in each file (default 1000)
+#      FLAGS       more options for the compiler, such as --packrat
+#
+
+set -u   # undefined variables are errors
+
+COMPILER="./bin/ada-cc"
+GENERATOR="./scripts/gen-adversarial.sh"
+
+BUDGET="${BUDGET:-1.3}"
+TIMEOUT="${TIMEOUT:-10}"
+COUNT="${COUNT:-1000}"
+FLAGS="${FLAGS:-}"
+
+FAMILIES=(paren operators aggregate named index slice mixed)
+DEPTHS=(16 32 64 128 256)
+
+WORK="$(mktemp -d)"
+trap 'rm -rf "$WORK"' EXIT
+
+failures=0
+total=0
+
+
+#
+# -- Parse a file, printing the milliseconds it took; fails if the parse does
+#    ------------------------------------------------------------------------
+parse_ms() {
+    local start end
+
+    start=$(date +%s%N)
+    timeout "$TIMEOUT" "$COMPILER" $FLAGS --max-nesting=4096 types "$1" > /dev/null 2>&1 || return 1
+    end=$(date +%s%N)
+
+    echo $(( (end - start) / 1000000 ))
+}
+
+
+#
+# -- The best of 3 runs, to keep the noise out of the small times
+#    ------------------------------------------------------------
+best_ms() {
+    local best="" t
+
+    for run in 1 2 3; do
+        t=$(parse_ms "$1") || return 1
+        if [ -z "$best" ] || [ "$t" -lt "$best" ]; then best=$t; fi
+    done
+
+    echo "$best"
+}
+
+
+echo "Fitting parse time against nesting depth for ${#FAMILIES[@]} families (budget: $BUDGET)"
+echo
+
+for family in "${FAMILIES[@]}"; do
+    printf "[ RUN      ] %s\r" "$family"
+
+    "$GENERATOR" "$family" 0 "$COUNT" > "$WORK/flat.ada"
+    base=$(best_ms "$WORK/flat.ada") || base=0
+
+    points=""
+    result=""
+
+    for depth in "${DEPTHS[@]}"; do
+        "$GENERATOR" "$family" "$depth" "$COUNT" > "$WORK/$family.ada"
+
+        if ! t=$(best_ms "$WORK/$family.ada"); then
+            result="failed or timed out at depth $depth"
+            break
+        fi
+
+        points+="$depth $(( t > base ? t - base : 1 ))"$'\n'
+    done
+
+    if [ -z "$result" ]; then
+        exponent=$(printf "%s" "$points" | awk '
+            { x = log($1); y = log($2); n ++; sx += x; sy += y; sxx += x * x; sxy += x * y }
+            END { printf "%.2f", (n * sxy - sx * sy) / (n * sxx - sx * sx) }')
+
+        if awk -v e="$exponent" -v b="$BUDGET" 'BEGIN { exit !(e <= b) }'; then
+            printf "[       OK ] %-10s exponent %s\n" "$family" "$exponent"
+        else
+            result="exponent $exponent"
+        fi
+    fi
+
+    if [ -n "$result" ]; then
+        printf "[  FAILED  ] %-10s %s\n" "$family" "$result"
+        failures=$((failures + 1))
+    fi
+
+    total=$((total + 1))
+done
+
+echo
+echo "================================"
+echo "Families  : $total"
+echo "Failures  : $failures"
+echo "================================"
+
+if [ "$failures" -ne 0 ]; then
+    exit 1
+fi
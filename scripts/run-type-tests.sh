@@ -17,7 +17,7 @@ for test in "${TESTS[@]}"; do
     name=$(basename "$test")
     printf "[ RUN      ] %s\r" "$name"
 
-    if "$COMPILER" types "$test" > /dev/null 2>&1 ; then
+    if "$COMPILER" types "$test" > /dev/null 2>&1 && "$COMPILER" --packrat types "$test" > /dev/null 2>&1 ; then
         printf "[       OK ] %s\n" "$name"
     else
         printf "[  FAILED  ] %s\n" "$name"
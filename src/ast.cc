@@ -0,0 +1,222 @@
+//=================================================================================================================
+//  ast.cc -- This is the implementation of the abstract syntax tree arena
+//
+//        Copyright (c)  2025-2026 -- Adam Clark; See LICENSE.md
+//
+// ---------------------------------------------------------------------------------------------------------------
+//
+//     Date      Tracker  Version  Pgmr  Description
+//  -----------  -------  -------  ----  -------------------------------------------------------------------------
+//  2026-Oct-17  Initial   0.0.0   ADCL  Initial version
+//
+//=================================================================================================================
+
+
+#include "ada.hh"
+
+
+
+//
+// -- Add a leaf covering the tokens `from` up to `to`, leaving it pending
+//    --------------------------------------------------------------------
+NodeRef_t AST::Leaf(NodeKind kind, TokenType op, SourceLoc_t loc, uint32_t value, int from, int to)
+{
+    NodeRef_t n = Add(ASTNode_t { kind, ProdID {}, op, loc, NoNode, NoNode, value });
+
+    pending.push_back(Pending_t { n, from, to });
+    return n;
+}
+
+
+
+//
+// -- Make the subtrees pending from `first` on into the children of a new node, which is left pending
+//    in their place
+//    ------------------------------------------------------------------------------------------------
+NodeRef_t AST::Reduce(NodeKind kind, TokenType op, SourceLoc_t loc, size_t first, int from, int to)
+{
+    assert(first <= pending.size());
+
+    NodeRef_t n = Add(ASTNode_t { kind, ProdID {}, op, loc, NoNode, NoNode, 0 });
+
+    if (first < pending.size()) {
+        nodes[n].child = pending[first].node;
+
+        for (size_t i = first + 1; i < pending.size(); i ++) nodes[pending[i - 1].node].next = pending[i].node;
+    }
+
+    pending.resize(first);
+    pending.push_back(Pending_t { n, from, to });
+    return n;
+}
+
+
+
+//
+// -- Make the subtrees pending from `first` on into the parts of a node for `prod`, for a production
+//    which is only known to be one once its parts have been parsed
+//    -----------------------------------------------------------------------------------------------
+NodeRef_t AST::Wrap(ProdID prod, SourceLoc_t loc, size_t first, int from, int to)
+{
+    NodeRef_t n = Reduce(NodeKind::Production, TokenType::YYEOF, loc, first, from, to);
+
+    nodes[n].prod = prod;
+    return n;
+}
+
+
+
+//
+// -- Finish a production which started at checkpoint `cp` and token `from`.  If it took no tokens it
+//    has failed, and whatever it built is dropped.  A lone subtree over the same tokens is passed on
+//    as it is, unless the production is to `keep` a node of its own; with `lift` a lone subtree is
+//    passed on whatever it covers, and is taken to cover the tokens of the production.
+//    ----------------------------------------------------------------------------------------------
+void AST::Close(ProdID prod, SourceLoc_t loc, const Checkpoint_t &cp, int from, int to, bool keep, bool lift)
+{
+    if (to == from) {
+        Rollback(cp);
+        return;
+    }
+
+    assert(pending.size() >= cp.pending);
+
+    if (!keep && pending.size() == cp.pending + 1) {
+        Pending_t &only = pending.back();
+
+        if (lift || (only.from == from && only.to == to)) {
+            only.from = from;
+            only.to = to;
+            return;
+        }
+    }
+
+    Wrap(prod, loc, cp.pending, from, to);
+}
+
+
+
+//
+// -- The two subtrees pending from `first` are a prefix and the suffix which follows it; make the
+//    prefix the first child of the suffix
+//    ---------------------------------------------------------------------------------------------
+void AST::Graft(size_t first)
+{
+    assert(pending.size() == first + 2);
+
+    Pending_t prefix = pending[first];
+    Pending_t suffix = pending[first + 1];
+
+    nodes[prefix.node].next = nodes[suffix.node].child;
+    nodes[suffix.node].child = prefix.node;
+
+    pending[first] = Pending_t { suffix.node, prefix.from, suffix.to };
+    pending.pop_back();
+}
+
+
+
+//
+// -- Copy out what has been built since a checkpoint; this fails if subtrees pending before the
+//    checkpoint have been taken as children since, since that cannot be built again
+//    ------------------------------------------------------------------------------------------
+bool AST::Since(const Checkpoint_t &cp, Fragment_t &frag) const
+{
+    if (pending.size() < cp.pending) return false;
+
+    frag.base = cp.nodes;
+    frag.stringBase = cp.strings;
+    frag.nodes.assign(nodes.begin() + cp.nodes, nodes.end());
+    frag.strings.assign(strings.begin() + cp.strings, strings.end());
+    frag.pending.assign(pending.begin() + cp.pending, pending.end());
+
+    return true;
+}
+
+
+
+//
+// -- Build a fragment again at the end of the arena, moving its references along with it
+//    -----------------------------------------------------------------------------------
+void AST::Replay(const Fragment_t &frag)
+{
+    uint32_t delta = (uint32_t)nodes.size() - frag.base;
+    uint32_t stringDelta = (uint32_t)strings.size() - frag.stringBase;
+    auto move = [delta](NodeRef_t n) -> NodeRef_t { return n == NoNode ? NoNode : n + delta; };
+
+    for (ASTNode_t n : frag.nodes) {
+        n.child = move(n.child);
+        n.next = move(n.next);
+        if (n.kind == NodeKind::StringLiteral) n.value += stringDelta;
+
+        nodes.push_back(n);
+    }
+
+    strings.insert(strings.end(), frag.strings.begin(), frag.strings.end());
+
+    for (Pending_t p : frag.pending) {
+        p.node = move(p.node);
+        pending.push_back(p);
+    }
+}
+
+
+
+//
+// -- Print the trees built so far, one line per node, with the children indented under their parent
+//    -----------------------------------------------------------------------------------------------
+void AST::Print(void) const
+{
+    std::vector<std::pair<NodeRef_t, int>> work;
+
+    std::cerr << "=========================================\n";
+    std::cerr << "=========================================\n";
+    std::cerr << "====   Printing Abstract Syntax Tree  ===\n";
+    std::cerr << "=========================================\n";
+    std::cerr << "=========================================\n";
+    std::cerr << '\n';
+
+    for (const Pending_t &root : pending) {
+        work.push_back({ root.node, 0 });
+
+        while (!work.empty()) {
+            auto [ref, level] = work.back();
+            const ASTNode_t &n = nodes[ref];
+            work.pop_back();
+
+            std::cerr << std::string(level * 2, ' ');
+
+            switch (n.kind) {
+            case NodeKind::Production:          std::cerr << ProductionName(n.prod);                            break;
+            case NodeKind::Identifier:          std::cerr << "identifier " << atoms.Spelling(n.value);          break;
+            case NodeKind::CharacterLiteral:    std::cerr << "character '" << (char)n.value << "'";             break;
+            case NodeKind::IntegerLiteral:      std::cerr << "integer " << literals.Integer(n.value).ToString(); break;
+            case NodeKind::RealLiteral:         std::cerr << "real " << literals.Real(n.value).ToString();       break;
+            case NodeKind::StringLiteral:
+                std::cerr << "string \"" << tokens->StringValue(strings[n.value]) << "\"";
+                break;
+            case NodeKind::Null:                std::cerr << "null";                                            break;
+            case NodeKind::Keyword:             std::cerr << "keyword " << tokens->tokenStr(n.op);              break;
+            case NodeKind::Unary:               std::cerr << "unary " << tokens->tokenStr(n.op);                break;
+            case NodeKind::Binary:              std::cerr << "binary " << tokens->tokenStr(n.op);               break;
+            case NodeKind::Membership:
+                std::cerr << (n.op == TokenType::TOK_NOT ? "membership not in" : "membership in");
+                break;
+            default:                            std::cerr << "(none)";                                          break;
+            }
+
+            ExpandedLoc_t where = TokenStream::Expand(n.loc);
+            if (where.valid) std::cerr << " [" << where.line << ":" << where.col << "]";
+            std::cerr << '\n';
+
+            // -- the siblings go on the stack first so that the children are printed before them
+            if (level > 0 && n.next != NoNode) work.push_back({ n.next, level });
+            if (n.child != NoNode) work.push_back({ n.child, level + 1 });
+        }
+    }
+
+    std::cerr << '\n';
+    std::cerr << "   Nodes: " << Size() << '\n';
+}
+
+
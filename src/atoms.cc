@@ -0,0 +1,79 @@
+//=================================================================================================================
+//  atoms.cc -- Implementation of the identifier interner
+//
+//        Copyright (c)  2025-2026 -- Adam Clark; See LICENSE.md
+//
+// ---------------------------------------------------------------------------------------------------------------
+//
+//     Date      Tracker  Version  Pgmr  Description
+//  -----------  -------  -------  ----  -------------------------------------------------------------------------
+//  2026-Oct-17  Initial   0.0.0   ADCL  Initial version
+//
+//=================================================================================================================
+
+
+
+#include "ada.hh"
+
+
+
+//
+// -- This is the global interner for the compilation
+//    -----------------------------------------------
+Interner atoms;
+
+
+
+//
+// -- Construct the interner with the empty spelling as atom 0
+//    --------------------------------------------------------
+Interner::Interner(void)
+{
+    spellings.emplace_back();
+    index.emplace(std::string_view(spellings.back()), NoAtom);
+}
+
+
+
+//
+// -- Intern a spelling exactly as given
+//    ----------------------------------
+Atom_t Interner::Intern(std::string_view s)
+{
+    std::lock_guard<std::mutex> g(lock);
+
+    auto it = index.find(s);
+    if (it != index.end()) return it->second;
+
+    Atom_t rv = static_cast<Atom_t>(spellings.size());
+    spellings.emplace_back(s);
+    index.emplace(std::string_view(spellings.back()), rv);
+
+    return rv;
+}
+
+
+
+//
+// -- Intern an identifier, folding it to lower case first.  Ada identifiers are limited to a single
+//    line, so a fixed buffer covers all practical cases; anything longer is folded on the heap.
+//    ----------------------------------------------------------------------------------------------
+Atom_t Interner::InternFolded(const char *s, size_t len)
+{
+    char buf[256];
+    std::string big;
+    char *dst = buf;
+
+    if (len > sizeof(buf)) {
+        big.resize(len);
+        dst = big.data();
+    }
+
+    for (size_t i = 0; i < len; i ++) {
+        char ch = s[i];
+        dst[i] = (ch >= 'A' && ch <= 'Z') ? ch - 'A' + 'a' : ch;
+    }
+
+    return Intern(std::string_view(dst, len));
+}
+
@@ -24,64 +24,158 @@ Diagnostics diags;
 
 
 //
-// -- Emit a diagnostic message
-//    -------------------------
-void Diagnostics::Emit(const std::string &level, DiagID id, SourceLoc_t loc, const std::vector<std::string> &args)
+// -- Emit a diagnostic message, queueing it as a record to be formatted when it is flushed
+//    -------------------------------------------------------------------------------------
+void Diagnostics::Emit(DiagLevel level, DiagID id, SourceLoc_t loc, std::initializer_list<std::string_view> args)
 {
     assert(DiagMsgs.find(id) != DiagMsgs.end());
 
-    auto it = DiagMsgs.find(id);
+    Diag_t d = { level, id, loc, (uint32_t)argPool.size(), (uint32_t)args.size(), 0, 0 };
+
+    for (std::string_view a : args) argPool.push_back(atoms.Intern(a));
+
+    Snapshot(d);
+    msgQueue.push_back(d);
+}
+
+
+
+//
+// -- Copy the productions the parser is in onto the end of the frame pool for a message
+//    ----------------------------------------------------------------------------------
+void Diagnostics::Snapshot(Diag_t &d)
+{
+    d.frames = framePool.size();
+    d.frameCount = 0;
+
+    if (parser) {
+        size_t n;
+        const ProdID *f = parser->Frames(n);
+
+        framePool.insert(framePool.end(), f, f + n);
+        d.frameCount = n;
+    }
+}
+
+
+
+//
+// -- Copy the messages queued since a checkpoint, dropping the outermost `skip` productions of each;
+//    fails if a message was reported from fewer productions than that
+//    ----------------------------------------------------------------------------------------------
+bool Diagnostics::Since(size_t loc, size_t skip, std::vector<Saved_t> &to) const
+{
+    assert(loc <= msgQueue.size());
+
+    for (size_t i = loc; i < msgQueue.size(); i ++) {
+        const Diag_t &d = msgQueue[i];
+        if (d.frameCount < skip) return false;
+
+        to.push_back(Saved_t {
+            d.level, d.id, d.loc,
+            std::vector<Atom_t>(argPool.begin() + d.args, argPool.begin() + d.args + d.argCount),
+            std::vector<ProdID>(framePool.begin() + d.frames + skip, framePool.begin() + d.frames + d.frameCount),
+        });
+    }
+
+    return true;
+}
+
+
+
+//
+// -- Queue a saved message again, under the productions the parser is in now
+//    -----------------------------------------------------------------------
+void Diagnostics::Replay(const Saved_t &s)
+{
+    Diag_t d = { s.level, s.id, s.loc, (uint32_t)argPool.size(), (uint32_t)s.args.size(), 0, 0 };
+
+    argPool.insert(argPool.end(), s.args.begin(), s.args.end());
+    Snapshot(d);
+    framePool.insert(framePool.end(), s.frames.begin(), s.frames.end());
+    d.frameCount += s.frames.size();
+
+    msgQueue.push_back(d);
+}
+
+
+
+//
+// -- Format and print the queued messages
+//    ------------------------------------
+void Diagnostics::Flush(void)
+{
+    for (const Diag_t &d : msgQueue) std::cerr << Render(d);
+
+    msgQueue.clear();
+    argPool.clear();
+    framePool.clear();
+}
+
+
+
+//
+// -- Format a queued message
+//    -----------------------
+std::string Diagnostics::Render(const Diag_t &d) const
+{
+    static const char *levels[] = { "error", "warning", "note" };
+
+    auto it = DiagMsgs.find(d.id);
     const std::string tmpl = (it == DiagMsgs.end() ? "" : it->second);
     std::string msg = "";
 
     if (tmpl == "") {
-        std::cerr << "internal error: unknown diagnostic ID "
-                  << static_cast<int>(id) << "\n";
-        return;
+        return "internal error: unknown diagnostic ID " + std::to_string(static_cast<int>(d.id)) + "\n";
     }
 
 
     std::string text;
     try {
-        text = Format(tmpl, args);  // e.g. replaces {0}, {1}, ...
+        text = Format(tmpl, argPool.data() + d.args, d.argCount);  // e.g. replaces {0}, {1}, ...
     } catch (const std::exception &ex) {
-        std::cerr << "internal error formatting diagnostic "
-                  << static_cast<int>(id) << ": "
-                  << ex.what() << "\n";
-        return;
+        return "internal error formatting diagnostic " + std::to_string(static_cast<int>(d.id)) + ": "
+                + ex.what() + "\n";
     }
 
 
-    if (loc.valid) {
-        msg += loc.filename;
+    ExpandedLoc_t where = TokenStream::Expand(d.loc);
+
+    if (where.valid) {
+        msg += where.filename;
         msg += ":";
-        msg += std::to_string(loc.line);
+        msg += std::to_string(where.line);
         msg += ":";
-        msg += std::to_string(loc.col);
+        msg += std::to_string(where.col);
         msg += ": ";
     }
 
 
-    msg += level;
+    msg += levels[(int)d.level];
     msg += ": ";
     msg += text;
     msg += "\n";
 
 
-    if (loc.valid && loc.sourceLine.size()) {
+    if (where.valid && where.sourceLine.size()) {
         msg += "    ";
-        msg += loc.sourceLine;
+        msg += where.sourceLine;
         msg += "\n";
         msg += "    ";
-        msg += std::string(loc.col - 1, ' ');
+        msg += std::string(where.col - 1, ' ');
         msg += "^";
         msg += "\n";
     }
 
 
-    if (parser) msg += parser->UnwindStack();
+    // -- the productions, innermost first
+    for (uint32_t i = d.frameCount; i > 0; i --) {
+        msg += "  in production `";
+        msg += ProductionName(framePool[d.frames + i - 1]);
+        msg += "`\n";
+    }
 
-    Queue(std::string("\e[31;1m") + msg + std::string("\e[0m"));
+    return std::string("\e[31;1m") + msg + std::string("\e[0m");
 }
 
 
@@ -89,11 +183,11 @@ void Diagnostics::Emit(const std::string &level, DiagID id, SourceLoc_t loc, con
 //
 // -- Format a diagnostic message
 //    ---------------------------
-std::string Diagnostics::Format(std::string tmpl, const std::vector<std::string> args)
+std::string Diagnostics::Format(const std::string &tmpl, const Atom_t *args, size_t argCount) const
 {
     const std::string &fmt = tmpl;
     std::string out;
-    out.reserve(fmt.size() + args.size() * 8);
+    out.reserve(fmt.size() + argCount * 8);
 
     for (size_t i = 0; i < fmt.size(); ++i) {
         if (fmt[i] == '{') {
@@ -125,8 +219,8 @@ std::string Diagnostics::Format(std::string tmpl, const std::vector<std::string>
                 valid = false;
             }
 
-            if (valid && idx >= 0 && (size_t)idx < args.size()) {
-                out += args[idx];   // substitute argument
+            if (valid && idx >= 0 && (size_t)idx < argCount) {
+                out += atoms.Spelling(args[idx]);   // substitute argument
             } else {
                 // Unknown placeholder—emit literally
                 out += '{';
@@ -169,6 +263,7 @@ const std::unordered_map<DiagID, std::string> Diagnostics::DiagMsgs = {
     { DiagID::InvalidPrimaryExpr, "invalid primary expression after {0}" },
     { DiagID::InvalidPrimaryExpr, "invalid expression in {0}" },
     { DiagID::MissingBasicDeclaration, "basic declaration is missing when required by command line parameters" },
+    { DiagID::NestingTooDeep, "expression nested more than {0} deep; the rest of it is skipped" },
     { DiagID::UnknownError, "there was an unknown error in file {0} in function {1} on line {2}" },
 };
 
@@ -0,0 +1,835 @@
+//=================================================================================================================
+//  fast-lexer.cc -- A hand-written lexer which produces the same tokens as the flex scanner
+//
+//        Copyright (c)  2025-2026 -- Adam Clark; See LICENSE.md
+//
+//  The flex scanner is the reference: every rule in `scanner.ll` is reproduced here, including the longest
+//  match between the numeric literal forms and the start conditions for pragmas.  Where this lexer differs
+//  is in how it gets through the bytes.  Each byte is classified from a 256-entry table and the long runs
+//  (whitespace, comments, identifiers and string bodies) are skipped a vector at a time with SSE2, or with
+//  AVX2 when the processor has it.
+//
+// ---------------------------------------------------------------------------------------------------------------
+//
+//     Date      Tracker  Version  Pgmr  Description
+//  -----------  -------  -------  ----  -------------------------------------------------------------------------
+//  2026-Oct-17  Initial   0.0.0   ADCL  Initial version
+//
+//=================================================================================================================
+
+
+
+#include "ada.hh"
+
+#include <algorithm>
+#include <array>
+
+#if defined(__x86_64__) || defined(__i386__)
+#  include <immintrin.h>
+#  define FAST_LEXER_X86 1
+#endif
+
+
+
+//
+// -- The character classes
+//    ---------------------
+enum : uint8_t {
+    CC_BLANK  = 0x01,               // -- ' ' and '\t'
+    CC_BREAK  = 0x02,               // -- '\n', '\r' and '\v', the flex {LF}
+    CC_LETTER = 0x04,
+    CC_DIGIT  = 0x08,
+    CC_HEX    = 0x10,
+    CC_IDENT  = 0x20,               // -- any character which can continue an identifier
+};
+
+
+static constexpr std::array<uint8_t, 256> MakeClasses(void)
+{
+    std::array<uint8_t, 256> rv = {};
+
+    rv[' '] = rv['\t'] = CC_BLANK;
+    rv['\n'] = rv['\r'] = rv['\v'] = CC_BREAK;
+    rv['_'] = CC_IDENT;
+
+    for (int c = 'a'; c <= 'z'; c ++) {
+        rv[c] = rv[c - 'a' + 'A'] = CC_LETTER | CC_IDENT;
+    }
+
+    for (int c = 'a'; c <= 'f'; c ++) {
+        rv[c] |= CC_HEX;
+        rv[c - 'a' + 'A'] |= CC_HEX;
+    }
+
+    for (int c = '0'; c <= '9'; c ++) {
+        rv[c] = CC_DIGIT | CC_HEX | CC_IDENT;
+    }
+
+    return rv;
+}
+
+
+static constexpr std::array<uint8_t, 256> charClass = MakeClasses();
+
+static inline uint8_t Class(char c) { return charClass[(uint8_t)c]; }
+
+
+
+//
+// -- The scanning kernels.  Each scans from `p` and stops at `end` at the latest.  `SkipBlanks` also
+//    counts the line feeds and remembers the last line break it passed over.
+//    ------------------------------------------------------------------------------------------------
+struct Kernels {
+    const char *(*skipBlanks)(const char *p, const char *end, uint32_t &lines, const char *&lastBreak);
+    const char *(*skipIdent)(const char *p, const char *end);
+    const char *(*findNewline)(const char *p, const char *end);
+    const char *(*findStringStop)(const char *p, const char *end);
+};
+
+
+
+//
+// -- The scalar kernels, which also finish off what the vector kernels leave
+//    -----------------------------------------------------------------------
+static const char *SkipBlanksScalar(const char *p, const char *end, uint32_t &lines, const char *&lastBreak)
+{
+    for ( ; p < end; p ++) {
+        uint8_t cc = Class(*p);
+
+        if (!(cc & (CC_BLANK | CC_BREAK))) break;
+        if (cc & CC_BREAK) {
+            lastBreak = p;
+            if (*p == '\n') lines ++;
+        }
+    }
+
+    return p;
+}
+
+
+static const char *SkipIdentScalar(const char *p, const char *end)
+{
+    while (p < end && (Class(*p) & CC_IDENT)) p ++;
+    return p;
+}
+
+
+static const char *FindNewlineScalar(const char *p, const char *end)
+{
+    while (p < end && *p != '\n') p ++;
+    return p;
+}
+
+
+static const char *FindStringStopScalar(const char *p, const char *end)
+{
+    while (p < end && *p != '"' && !(Class(*p) & CC_BREAK)) p ++;
+    return p;
+}
+
+
+
+#ifdef FAST_LEXER_X86
+//
+// -- The SSE2 kernels, which classify 16 bytes at a time with compares
+//    -----------------------------------------------------------------
+static const char *SkipBlanksSse2(const char *p, const char *end, uint32_t &lines, const char *&lastBreak)
+{
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i lf = _mm_set1_epi8('\n');
+    const __m128i cr = _mm_set1_epi8('\r');
+    const __m128i vt = _mm_set1_epi8('\v');
+
+    while (p + 16 <= end) {
+        __m128i v = _mm_loadu_si128((const __m128i *)p);
+        __m128i nl = _mm_cmpeq_epi8(v, lf);
+        __m128i brk = _mm_or_si128(nl, _mm_or_si128(_mm_cmpeq_epi8(v, cr), _mm_cmpeq_epi8(v, vt)));
+        __m128i blank = _mm_or_si128(brk, _mm_or_si128(_mm_cmpeq_epi8(v, space), _mm_cmpeq_epi8(v, tab)));
+
+        uint32_t stop = ~(uint32_t)_mm_movemask_epi8(blank) & 0xffff;
+        uint32_t valid = stop ? (1u << __builtin_ctz(stop)) - 1 : 0xffff;
+        uint32_t nlMask = (uint32_t)_mm_movemask_epi8(nl) & valid;
+        uint32_t brkMask = (uint32_t)_mm_movemask_epi8(brk) & valid;
+
+        lines += __builtin_popcount(nlMask);
+        if (brkMask) lastBreak = p + (31 - __builtin_clz(brkMask));
+        if (stop) return p + __builtin_ctz(stop);
+
+        p += 16;
+    }
+
+    return SkipBlanksScalar(p, end, lines, lastBreak);
+}
+
+
+static const char *SkipIdentSse2(const char *p, const char *end)
+{
+    const __m128i bias = _mm_set1_epi8((char)0x80);
+
+    while (p + 16 <= end) {
+        __m128i v = _mm_loadu_si128((const __m128i *)p);
+
+        // -- unsigned range checks done as signed compares on biased values
+        __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+        __m128i letter = _mm_cmplt_epi8(_mm_xor_si128(_mm_sub_epi8(lower, _mm_set1_epi8('a')), bias),
+                                        _mm_set1_epi8((char)(26 ^ 0x80)));
+        __m128i digit = _mm_cmplt_epi8(_mm_xor_si128(_mm_sub_epi8(v, _mm_set1_epi8('0')), bias),
+                                       _mm_set1_epi8((char)(10 ^ 0x80)));
+        __m128i under = _mm_cmpeq_epi8(v, _mm_set1_epi8('_'));
+        __m128i ident = _mm_or_si128(letter, _mm_or_si128(digit, under));
+
+        uint32_t stop = ~(uint32_t)_mm_movemask_epi8(ident) & 0xffff;
+        if (stop) return p + __builtin_ctz(stop);
+
+        p += 16;
+    }
+
+    return SkipIdentScalar(p, end);
+}
+
+
+static const char *FindNewlineSse2(const char *p, const char *end)
+{
+    const __m128i lf = _mm_set1_epi8('\n');
+
+    while (p + 16 <= end) {
+        uint32_t m = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)p), lf));
+        if (m) return p + __builtin_ctz(m);
+
+        p += 16;
+    }
+
+    return FindNewlineScalar(p, end);
+}
+
+
+static const char *FindStringStopSse2(const char *p, const char *end)
+{
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i lf = _mm_set1_epi8('\n');
+    const __m128i cr = _mm_set1_epi8('\r');
+    const __m128i vt = _mm_set1_epi8('\v');
+
+    while (p + 16 <= end) {
+        __m128i v = _mm_loadu_si128((const __m128i *)p);
+        __m128i hit = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, lf)),
+                                   _mm_or_si128(_mm_cmpeq_epi8(v, cr), _mm_cmpeq_epi8(v, vt)));
+
+        uint32_t m = _mm_movemask_epi8(hit);
+        if (m) return p + __builtin_ctz(m);
+
+        p += 16;
+    }
+
+    return FindStringStopScalar(p, end);
+}
+
+
+
+//
+// -- The AVX2 kernels.  These classify 32 bytes at a time with a pair of nibble tables: the class bits
+//    of a byte are `lo[byte & 0xf] & hi[byte >> 4]`.  The bits in the tables are:
+//
+//    0x01: '0'..'9'           (hi 3, lo 0-9)
+//    0x02: 'A'..'O', 'a'..'o' (hi 4 and 6, lo 1-15)
+//    0x04: 'P'..'Z', 'p'..'z' (hi 5 and 7, lo 0-10)
+//    0x08: '_'                (hi 5, lo 15)
+//    0x10: '\t' '\n' '\v' '\r' (hi 0, lo 9, 10, 11, 13)
+//    0x20: ' '                (hi 2, lo 0)
+//    -----------------------------------------------------------------------------------------------------
+#define NIBBLE_IDENT        0x0f
+#define NIBBLE_BLANK        0x30
+
+
+__attribute__((target("avx2")))
+static inline __m256i ClassifyAvx2(__m256i v)
+{
+    const __m256i lo = _mm256_setr_epi8(0x25, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+                                        0x07, 0x17, 0x16, 0x12, 0x02, 0x12, 0x02, 0x0a,
+                                        0x25, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+                                        0x07, 0x17, 0x16, 0x12, 0x02, 0x12, 0x02, 0x0a);
+    const __m256i hi = _mm256_setr_epi8(0x10, 0x00, 0x20, 0x01, 0x02, 0x0c, 0x02, 0x04,
+                                        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                        0x10, 0x00, 0x20, 0x01, 0x02, 0x0c, 0x02, 0x04,
+                                        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00);
+    const __m256i nibble = _mm256_set1_epi8(0x0f);
+
+    __m256i l = _mm256_shuffle_epi8(lo, _mm256_and_si256(v, nibble));
+    __m256i h = _mm256_shuffle_epi8(hi, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble));
+
+    return _mm256_and_si256(l, h);
+}
+
+
+__attribute__((target("avx2")))
+static const char *SkipBlanksAvx2(const char *p, const char *end, uint32_t &lines, const char *&lastBreak)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i lf = _mm256_set1_epi8('\n');
+    const __m256i cr = _mm256_set1_epi8('\r');
+    const __m256i vt = _mm256_set1_epi8('\v');
+
+    while (p + 32 <= end) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)p);
+        __m256i cls = _mm256_and_si256(ClassifyAvx2(v), _mm256_set1_epi8(NIBBLE_BLANK));
+        __m256i nl = _mm256_cmpeq_epi8(v, lf);
+        __m256i brk = _mm256_or_si256(nl, _mm256_or_si256(_mm256_cmpeq_epi8(v, cr), _mm256_cmpeq_epi8(v, vt)));
+
+        uint32_t stop = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(cls, zero));
+        uint32_t valid = stop ? (1u << __builtin_ctz(stop)) - 1 : 0xffffffff;
+        uint32_t nlMask = (uint32_t)_mm256_movemask_epi8(nl) & valid;
+        uint32_t brkMask = (uint32_t)_mm256_movemask_epi8(brk) & valid;
+
+        lines += __builtin_popcount(nlMask);
+        if (brkMask) lastBreak = p + (31 - __builtin_clz(brkMask));
+        if (stop) return p + __builtin_ctz(stop);
+
+        p += 32;
+    }
+
+    return SkipBlanksSse2(p, end, lines, lastBreak);
+}
+
+
+__attribute__((target("avx2")))
+static const char *SkipIdentAvx2(const char *p, const char *end)
+{
+    const __m256i zero = _mm256_setzero_si256();
+
+    while (p + 32 <= end) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)p);
+        __m256i cls = _mm256_and_si256(ClassifyAvx2(v), _mm256_set1_epi8(NIBBLE_IDENT));
+
+        uint32_t stop = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(cls, zero));
+        if (stop) return p + __builtin_ctz(stop);
+
+        p += 32;
+    }
+
+    return SkipIdentSse2(p, end);
+}
+
+
+__attribute__((target("avx2")))
+static const char *FindNewlineAvx2(const char *p, const char *end)
+{
+    const __m256i lf = _mm256_set1_epi8('\n');
+
+    while (p + 32 <= end) {
+        uint32_t m = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)p), lf));
+        if (m) return p + __builtin_ctz(m);
+
+        p += 32;
+    }
+
+    return FindNewlineSse2(p, end);
+}
+
+
+__attribute__((target("avx2")))
+static const char *FindStringStopAvx2(const char *p, const char *end)
+{
+    const __m256i quote = _mm256_set1_epi8('"');
+    const __m256i lf = _mm256_set1_epi8('\n');
+    const __m256i cr = _mm256_set1_epi8('\r');
+    const __m256i vt = _mm256_set1_epi8('\v');
+
+    while (p + 32 <= end) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)p);
+        __m256i hit = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, quote), _mm256_cmpeq_epi8(v, lf)),
+                                      _mm256_or_si256(_mm256_cmpeq_epi8(v, cr), _mm256_cmpeq_epi8(v, vt)));
+
+        uint32_t m = _mm256_movemask_epi8(hit);
+        if (m) return p + __builtin_ctz(m);
+
+        p += 32;
+    }
+
+    return FindStringStopSse2(p, end);
+}
+#endif
+
+
+
+//
+// -- Choose the kernels for this processor once
+//    ------------------------------------------
+static Kernels SelectKernels(void)
+{
+#ifdef FAST_LEXER_X86
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2")) {
+        return { SkipBlanksAvx2, SkipIdentAvx2, FindNewlineAvx2, FindStringStopAvx2 };
+    }
+
+    return { SkipBlanksSse2, SkipIdentSse2, FindNewlineSse2, FindStringStopSse2 };
+#else
+    return { SkipBlanksScalar, SkipIdentScalar, FindNewlineScalar, FindStringStopScalar };
+#endif
+}
+
+
+static const Kernels kernels = SelectKernels();
+
+
+
+//
+// -- Runs of digits (or hex digits) with underscores, as in `{DIGIT}({UNDERLINE}|{DIGIT})*`; returns `q`
+//    unchanged when there is no leading digit
+//    ---------------------------------------------------------------------------------------------------
+static const char *DigitRun(const char *q, const char *end, uint8_t cls)
+{
+    if (q >= end || !(Class(*q) & cls)) return q;
+
+    for (q ++; q < end && ((Class(*q) & cls) || *q == '_'); q ++) {}
+    return q;
+}
+
+
+//
+// -- An optional exponent, as in `e\+?{DIGIT}...` or `e-{DIGIT}...`; returns `q` unchanged when there
+//    is no complete exponent
+//    ------------------------------------------------------------------------------------------------
+static const char *Exponent(const char *q, const char *end)
+{
+    if (q < end && (*q == 'e' || *q == 'E')) {
+        const char *s = q + 1;
+
+        if (s < end && (*s == '+' || *s == '-')) s ++;
+
+        const char *d = DigitRun(s, end, CC_DIGIT);
+        if (d > s) return d;
+    }
+
+    return q;
+}
+
+
+
+//
+// -- Construct the lexer at the start of the source
+//    ----------------------------------------------
+FastLexer::FastLexer(const SourceFile &source)
+        : base(source.Buffer()), p(source.Buffer()), end(source.Buffer() + source.Size()),
+          state(State::Initial), offset(0), line(0), column(1)
+{
+}
+
+
+
+//
+// -- Construct the lexer over a window of the source, which must start at the beginning of a line and
+//    end just after a line break (or at the end of the source)
+//    -------------------------------------------------------------------------------------------------
+FastLexer::FastLexer(const SourceFile &source, uint32_t from, uint32_t to)
+        : base(source.Buffer()), p(source.Buffer() + from), end(source.Buffer() + to),
+          state(State::Initial), offset(from), line(0), column(1)
+{
+}
+
+
+
+//
+// -- Get the next token, depending on the start condition
+//    ----------------------------------------------------
+TokenType FastLexer::Next(void)
+{
+    switch (state) {
+    case State::PragmaName:     return NextPragmaName();
+    case State::PragmaArgs:     return NextPragmaArgs();
+    default:                    return NextInitial();
+    }
+}
+
+
+
+//
+// -- Skip a run of whitespace and line breaks.  A line break sets the column back to 1, so the column
+//    is 1 plus whatever follows the last break in the run.
+//    ------------------------------------------------------------------------------------------------
+void FastLexer::SkipBlanks(void)
+{
+    uint32_t lines = 0;
+    const char *lastBreak = nullptr;
+    const char *q = kernels.skipBlanks(p, end, lines, lastBreak);
+
+    line += lines;
+    if (lastBreak) column = 1 + (q - lastBreak - 1);
+    else column += q - p;
+
+    p = q;
+}
+
+
+
+//
+// -- A line break which ends a string or a pragma in error.  The flex {LF} matches `\n\r` and `\r\n` as
+//    one break, and these rules leave the column at 0.
+//    --------------------------------------------------------------------------------------------------
+TokenType FastLexer::Break(void)
+{
+    const char *q = p + 1;
+
+    if ((p[0] == '\n' && p[1] == '\r') || (p[0] == '\r' && p[1] == '\n')) q ++;
+
+    for (const char *s = p; s < q; s ++) if (*s == '\n') line ++;
+
+    offset = p - base;
+    p = q;
+    column = 0;
+    state = State::Initial;
+
+    return TokenType::TOK_ERROR;
+}
+
+
+
+//
+// -- The INITIAL start condition
+//    ---------------------------
+TokenType FastLexer::NextInitial(void)
+{
+    for (;;) {
+        if (p >= end) {
+            offset = end - base;
+            return TokenType::YYEOF;
+        }
+
+        uint8_t cc = Class(*p);
+
+        if (cc & (CC_BLANK | CC_BREAK)) {
+            SkipBlanks();
+            continue;
+        }
+
+        if (p[0] == '-' && p[1] == '-') {
+            const char *q = kernels.findNewline(p + 2, end);
+            column += q - p;
+            p = q;
+            continue;
+        }
+
+        offset = p - base;
+
+        if (cc & CC_LETTER) return Identifier(true);
+        if (cc & CC_DIGIT) return Number();
+        if (*p == '"') return String();
+
+        if (p[0] == '\'' && p + 2 < end && p[1] != '\n' && p[2] == '\'') {
+            payload = CharLiteral { offset, p[1] };
+            column += 3;
+            p += 3;
+            return TokenType::TOK_CHARACTER_LITERAL;
+        }
+
+        return Operator();
+    }
+}
+
+
+
+//
+// -- The <prg> start condition: the pragma name follows the `pragma` keyword
+//    -----------------------------------------------------------------------
+TokenType FastLexer::NextPragmaName(void)
+{
+    for (;;) {
+        if (p >= end) {
+            offset = end - base;
+            return TokenType::YYEOF;
+        }
+
+        uint8_t cc = Class(*p);
+
+        if (cc & CC_BLANK) {
+            column ++;
+            p ++;
+            continue;
+        }
+
+        offset = p - base;
+
+        if (cc & CC_BREAK) return Break();
+
+        if (cc & CC_LETTER) {
+            const char *q = kernels.skipIdent(p + 1, end);
+            column += q - p;
+            p = q;
+            state = State::PragmaArgs;
+            return TokenType::TOK_PRAGMA_NAME;
+        }
+
+        column ++;
+        p ++;
+        state = State::Initial;
+        return TokenType::TOK_ERROR;
+    }
+}
+
+
+
+//
+// -- The <arg> start condition: the pragma arguments.  Flex has no rule for a line feed here, so its
+//    default rule consumes it; that is matched by simply counting the line.
+//    -----------------------------------------------------------------------------------------------
+TokenType FastLexer::NextPragmaArgs(void)
+{
+    for (;;) {
+        if (p >= end) {
+            offset = end - base;
+            return TokenType::YYEOF;
+        }
+
+        uint8_t cc = Class(*p);
+
+        if (cc & CC_BLANK) {
+            column ++;
+            p ++;
+            continue;
+        }
+
+        if (*p == '\n') {
+            line ++;
+            p ++;
+            continue;
+        }
+
+        offset = p - base;
+
+        switch (*p) {
+        case ';':
+            column ++; p ++;
+            state = State::Initial;
+            return TokenType::TOK_SEMICOLON;
+
+        case '(':
+            column ++; p ++;
+            return TokenType::TOK_LEFT_PARENTHESIS;
+
+        case ')':
+            column ++; p ++;
+            state = State::Initial;
+            return TokenType::TOK_RIGHT_PARENTHESIS;
+
+        case ',':
+            column ++; p ++;
+            return TokenType::TOK_COMMA;
+
+        case '=':
+            if (p[1] == '>') {
+                column += 2; p += 2;
+                return TokenType::TOK_ARROW;
+            }
+            break;
+
+        default:
+            break;
+        }
+
+        if (cc & CC_LETTER) return Identifier(false);
+
+        column ++;
+        p ++;
+        state = State::Initial;
+        return TokenType::TOK_ERROR;
+    }
+}
+
+
+
+//
+// -- An identifier, which may turn out to be a reserved word (there are none in pragma arguments)
+//    --------------------------------------------------------------------------------------------
+TokenType FastLexer::Identifier(bool reserved)
+{
+    const char *q = kernels.skipIdent(p + 1, end);
+    size_t len = q - p;
+    TokenType tok = reserved ? Keyword(p, len) : TokenType::TOK_IDENTIFIER;
+
+    if (tok == TokenType::TOK_IDENTIFIER) payload = IdentifierLexeme { atoms.InternFolded(p, len) };
+    if (tok == TokenType::TOK_PRAGMA) state = State::PragmaName;
+
+    column += len;
+    p = q;
+    return tok;
+}
+
+
+
+//
+// -- A numeric literal.  Flex takes the longest match over all the numeric rules, so take each form
+//    as far as it will go and fall back to the integer part when a longer form is not complete.
+//    ----------------------------------------------------------------------------------------------
+TokenType FastLexer::Number(void)
+{
+    const char *q = DigitRun(p, end, CC_DIGIT);
+    const char *last = q;
+    bool real = false;
+
+    if (q < end && *q == '#') {
+        const char *h = DigitRun(q + 1, end, CC_HEX);
+
+        if (h > q + 1 && h < end) {
+            if (*h == '#') {
+                last = Exponent(h + 1, end);
+            } else if (*h == '.') {
+                const char *f = DigitRun(h + 1, end, CC_HEX);
+
+                if (f > h + 1 && f < end && *f == '#') {
+                    last = Exponent(f + 1, end);
+                    real = true;
+                }
+            }
+        }
+    } else {
+        if (q < end && *q == '.') {
+            const char *f = DigitRun(q + 1, end, CC_DIGIT);
+
+            if (f > q + 1) {
+                q = f;
+                real = true;
+            }
+        }
+
+        last = Exponent(q, end);
+    }
+
+    size_t len = last - p;
+
+    if (real) payload = NumericLiteral { literals.AddReal(p, len) };
+    else payload = NumericLiteral { literals.AddInteger(p, len) };
+
+    column += len;
+    p = last;
+    return real ? TokenType::TOK_UNIVERSAL_REAL_LITERAL : TokenType::TOK_UNIVERSAL_INT_LITERAL;
+}
+
+
+
+//
+// -- A string literal, scanned in one go up to the closing quote.  Doubled quotes stay in the text.
+//    ----------------------------------------------------------------------------------------------
+TokenType FastLexer::String(void)
+{
+    const char *s = p + 1;
+    uint32_t start = s - base;
+    bool escaped = false;
+
+    column ++;
+
+    for (;;) {
+        const char *q = kernels.findStringStop(s, end);
+        column += q - s;
+
+        if (q >= end) {
+            p = end;
+            offset = end - base;
+            return TokenType::YYEOF;
+        }
+
+        if (*q != '"') {
+            p = q;
+            return Break();
+        }
+
+        if (q + 1 < end && q[1] == '"') {
+            escaped = true;
+            column += 2;
+            s = q + 2;
+            continue;
+        }
+
+        offset = q - base;
+        payload = StringLiteral { start, (uint32_t)(q - base) - start, escaped };
+        column ++;
+        p = q + 1;
+        return TokenType::TOK_STRING_LITERAL;
+    }
+}
+
+
+
+//
+// -- The delimiters, compound delimiters and anything else
+//    -----------------------------------------------------
+TokenType FastLexer::Operator(void)
+{
+    TokenType tok = TokenType::TOK_ERROR;
+    char next = p[1];
+    int len = 1;
+
+    switch (*p) {
+    case '&':   tok = TokenType::TOK_AMPERSAND;                 break;
+    case '(':   tok = TokenType::TOK_LEFT_PARENTHESIS;          break;
+    case ')':   tok = TokenType::TOK_RIGHT_PARENTHESIS;         break;
+    case '+':   tok = TokenType::TOK_PLUS;                      break;
+    case ',':   tok = TokenType::TOK_COMMA;                     break;
+    case '-':   tok = TokenType::TOK_HYPHEN;                    break;
+    case ';':   tok = TokenType::TOK_SEMICOLON;                 break;
+    case '_':   tok = TokenType::TOK_UNDERLINE;                 break;
+    case '|':   tok = TokenType::TOK_VERTICAL_BAR;              break;
+    case '!':   tok = TokenType::TOK_EXCLAMATION_MARK;          break;
+    case '$':   tok = TokenType::TOK_DOLLAR;                    break;
+    case '%':   tok = TokenType::TOK_PERCENT;                   break;
+    case '?':   tok = TokenType::TOK_QUESTION_MARK;             break;
+    case '@':   tok = TokenType::TOK_COMMERCIAL_AT;             break;
+    case '[':   tok = TokenType::TOK_LEFT_SQUARE_BRACKET;       break;
+    case '\\':  tok = TokenType::TOK_BACK_SLASH;                break;
+    case ']':   tok = TokenType::TOK_RIGHT_SQUARE_BRACKET;      break;
+    case '^':   tok = TokenType::TOK_CIRCUMFLEX;                break;
+    case '`':   tok = TokenType::TOK_GRAVE_ACCENT;              break;
+    case '{':   tok = TokenType::TOK_LEFT_BRACE;                break;
+    case '}':   tok = TokenType::TOK_RIGHT_BRACE;               break;
+    case '~':   tok = TokenType::TOK_TILDE;                     break;
+    case '\'':  tok = TokenType::TOK_APOSTROPHE;                break;
+    case '#':   tok = TokenType::TOK_SHARP;                     break;
+
+    case '*':
+        if (next == '*') { tok = TokenType::TOK_DOUBLE_STAR; len = 2; }
+        else tok = TokenType::TOK_STAR;
+        break;
+
+    case '.':
+        if (next == '.') { tok = TokenType::TOK_DOUBLE_DOT; len = 2; }
+        else tok = TokenType::TOK_DOT;
+        break;
+
+    case '/':
+        if (next == '=') { tok = TokenType::TOK_INEQUALITY; len = 2; }
+        else tok = TokenType::TOK_SLASH;
+        break;
+
+    case ':':
+        if (next == '=') { tok = TokenType::TOK_ASSIGNMENT; len = 2; }
+        else tok = TokenType::TOK_COLON;
+        break;
+
+    case '=':
+        if (next == '>') { tok = TokenType::TOK_ARROW; len = 2; }
+        else tok = TokenType::TOK_EQUAL;
+        break;
+
+    case '<':
+        if (next == '=') { tok = TokenType::TOK_LESS_THAN_OR_EQUAL; len = 2; }
+        else if (next == '<') { tok = TokenType::TOK_LEFT_LABEL_BRACKET; len = 2; }
+        else if (next == '>') { tok = TokenType::TOK_BOX; len = 2; }
+        else tok = TokenType::TOK_LESS_THAN;
+        break;
+
+    case '>':
+        if (next == '=') { tok = TokenType::TOK_GREATER_THAN_OR_EQUAL; len = 2; }
+        else if (next == '>') { tok = TokenType::TOK_RIGHT_LABEL_BRACKET; len = 2; }
+        else tok = TokenType::TOK_GREATER_THAN;
+        break;
+
+    default:
+        break;
+    }
+
+    column += len;
+    p += len;
+    return tok;
+}
+
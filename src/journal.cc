@@ -0,0 +1,95 @@
+//=================================================================================================================
+//  journal.cc -- This is the implementation of the undo journal
+//
+//        Copyright (c)  2025-2026 -- Adam Clark; See LICENSE.md
+//
+// ---------------------------------------------------------------------------------------------------------------
+//
+//     Date      Tracker  Version  Pgmr  Description
+//  -----------  -------  -------  ----  -------------------------------------------------------------------------
+//  2026-Oct-17  Initial   0.0.0   ADCL  Initial version
+//
+//=================================================================================================================
+
+
+#include "ada.hh"
+
+
+
+//
+// -- Open a checkpoint at the current state of the parse
+//    ---------------------------------------------------
+Journal::Checkpoint_t Journal::Checkpoint(void)
+{
+    marks.push_back(Mark_t { log.size(), tokens.Mark(), diags.Checkpoint(), diags.Errors(), diags.Warnings(),
+            tree.Checkpoint(), scopes.Epoch() });
+
+    return (Checkpoint_t)(marks.size() - 1);
+}
+
+
+
+//
+// -- Put everything back as it was at a checkpoint, which stays open
+//    ---------------------------------------------------------------
+void Journal::Rollback(Checkpoint_t cp)
+{
+    assert(cp < marks.size());
+    const Mark_t &m = marks[cp];
+
+    if (profile) profile->Rewound(tokens.Location() - m.token, diags.Checkpoint() - m.diag);
+
+    while (log.size() > m.undo) {
+        const Undo_t &u = log.back();
+
+        switch (u.kind) {
+        case UndoKind::Declare:
+            u.scope->Undeclare();
+            break;
+
+        case UndoKind::Retire:
+            u.sym->kind = u.was;
+            break;
+
+        case UndoKind::PushScope:
+            scopes.stack.pop_back();
+            scopes.current = u.scope;
+            break;
+
+        case UndoKind::PopScope:
+            scopes.current = u.scope;
+            break;
+        }
+
+        log.pop_back();
+    }
+
+    tokens.Reset(m.token);
+    diags.Rollback(m.diag);
+    diags.Errors() = m.errors;
+    diags.Warnings() = m.warnings;
+    tree.Rollback(m.tree);
+    scopes.Restore(m.epoch);
+}
+
+
+
+//
+// -- Close the innermost checkpoint, keeping whatever has been done since; once the last one is closed
+//    nothing can be undone any more, so the log is emptied and the diagnostics are written
+//    -------------------------------------------------------------------------------------------------
+void Journal::Release(Checkpoint_t cp)
+{
+    assert(cp == marks.size() - 1);
+
+    tokens.Unmark();
+    marks.pop_back();
+
+    if (marks.empty()) {
+        log.clear();
+        diags.Flush();
+    }
+}
+
+
+
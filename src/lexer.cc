@@ -0,0 +1,128 @@
+//=================================================================================================================
+//  lexer.cc -- Creation of a lexer and the adapter for the flex scanner
+//
+//        Copyright (c)  2025-2026 -- Adam Clark; See LICENSE.md
+//
+// ---------------------------------------------------------------------------------------------------------------
+//
+//     Date      Tracker  Version  Pgmr  Description
+//  -----------  -------  -------  ----  -------------------------------------------------------------------------
+//  2026-Oct-17  Initial   0.0.0   ADCL  Initial version
+//
+//=================================================================================================================
+
+
+
+#include "ada.hh"
+
+
+
+//
+// -- These are provided by the flex scanner
+//    --------------------------------------
+extern TokenType yylex(void *scanner);
+extern void *ScanBegin(ScanContext_t *ctx, char *base, size_t size);
+extern void ScanEnd(void *scanner);
+extern uint32_t ScanLine(void *scanner);
+extern std::string_view ScanText(void *scanner);
+extern bool ScanInitial(void *scanner);
+
+
+
+//
+// -- Create a lexer of the requested kind over the source
+//    ----------------------------------------------------
+std::unique_ptr<Lexer> Lexer::Create(Kind kind, const SourceFile &source)
+{
+    if (kind == Kind::Fast) return std::make_unique<FastLexer>(source);
+    return std::make_unique<FlexAdapter>(source);
+}
+
+
+
+//
+// -- Create a lexer of the requested kind over a window of the source
+//    ----------------------------------------------------------------
+std::unique_ptr<Lexer> Lexer::Create(Kind kind, const SourceFile &source, uint32_t from, uint32_t to)
+{
+    if (kind == Kind::Fast) return std::make_unique<FastLexer>(source, from, to);
+    return std::make_unique<FlexAdapter>(source, from, to);
+}
+
+
+
+//
+// -- Point the flex scanner at the source buffer
+//    -------------------------------------------
+FlexAdapter::FlexAdapter(const SourceFile &source) : origin(0)
+{
+    Begin(source, source.Buffer(), source.BufferSize());
+}
+
+
+
+//
+// -- Point the flex scanner at a copy of a window of the source
+//    ----------------------------------------------------------
+FlexAdapter::FlexAdapter(const SourceFile &source, uint32_t from, uint32_t to) : origin(from)
+{
+    window.reserve(to - from + 2);
+    window.assign(source.Buffer() + from, source.Buffer() + to);
+    window.push_back('\0');
+    window.push_back('\0');
+
+    Begin(source, window.data(), window.size());
+}
+
+
+
+//
+// -- Create the scanner over the buffer
+//    ----------------------------------
+void FlexAdapter::Begin(const SourceFile &source, char *buf, size_t size)
+{
+    scanner = ScanBegin(&ctx, buf, size);
+
+    if (!scanner) {
+        std::cerr << "Unable to scan the source buffer for " << source.Name() << '\n';
+        exit(EXIT_FAILURE);
+    }
+}
+
+
+
+//
+// -- Release the flex scanner
+//    ------------------------
+FlexAdapter::~FlexAdapter()
+{
+    ScanEnd(scanner);
+}
+
+
+
+//
+// -- Get the next token; the literal offsets from a window are moved back to source offsets
+//    --------------------------------------------------------------------------------------
+TokenType FlexAdapter::Next(void)
+{
+    TokenType tok = yylex(scanner);
+
+    if (origin && tok == TokenType::TOK_CHARACTER_LITERAL) std::get<CharLiteral>(ctx.payload).offset += origin;
+    if (origin && tok == TokenType::TOK_STRING_LITERAL) std::get<StringLiteral>(ctx.payload).offset += origin;
+
+    return tok;
+}
+
+
+
+//
+// -- The rest is simply reading back the scanner state
+//    -------------------------------------------------
+uint32_t FlexAdapter::Offset(void) const { return ScanText(scanner).data() - ctx.base + origin; }
+uint32_t FlexAdapter::Line(void) const { return ScanLine(scanner); }
+uint32_t FlexAdapter::Column(void) const { return ctx.column; }
+const YYSTYPE &FlexAdapter::Payload(void) const { return ctx.payload; }
+bool FlexAdapter::AtBoundary(void) const { return ScanInitial(scanner) && ctx.column == 1; }
+std::string_view FlexAdapter::Text(void) const { return ScanText(scanner); }
+
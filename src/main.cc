@@ -15,6 +15,9 @@
 
 #include "ada.hh"
 
+#include <unistd.h>
+#include <pthread.h>
+
 
 
 //
@@ -47,17 +50,17 @@ Options opts;
 //    -----------------------------------
 static int Scan(std::string filename)
 {
-    extern char *yytext;
-    extern TokenType yylex(void);
-    extern FILE *yyin;
-
-    yyin = fopen(filename.c_str(), "r");
-    if (!yyin) {
+    FILE *fp = fopen(filename.c_str(), "r");
+    if (!fp) {
         std::cerr << "Unable to open file " << filename << '\n';
         return EXIT_FAILURE;
     }
+    fclose(fp);
 
-    TokenType tok = yylex();
+    SourceFile source(filename.c_str());
+    FlexAdapter lexer(source);
+
+    TokenType tok = lexer.Next();
 
     while ((int)tok) {
         switch (tok) {
@@ -172,27 +175,32 @@ static int Scan(std::string filename)
         case TokenType::TOK_OR_ELSE:               std::cout << "OR ELSE\n";   break;
 
         case TokenType::TOK_IDENTIFIER:
-            std::cout << "IDENTIFIER: (" << yytext << ")\n";
+            std::cout << "IDENTIFIER: (" << lexer.Text() << ")\n";
             break;
 
         case TokenType::TOK_UNIVERSAL_INT_LITERAL:
-            std::cout << "INTEGER LITERAL: (" << yytext << ")\n";
+            std::cout << "INTEGER LITERAL: (" << lexer.Text() << ") = "
+                    << literals.Integer(std::get<NumericLiteral>(lexer.Payload()).index).ToString() << '\n';
             break;
 
         case TokenType::TOK_UNIVERSAL_REAL_LITERAL:
-            std::cout << "REAL LITERAL: (" << yytext << ")\n";
+            std::cout << "REAL LITERAL: (" << lexer.Text() << ") = "
+                    << literals.Real(std::get<NumericLiteral>(lexer.Payload()).index).ToString() << '\n';
             break;
 
         case TokenType::TOK_CHARACTER_LITERAL:
-            std::cout << "CHARACTER LITERAL: (" << yytext[1] << ")\n";
+            std::cout << "CHARACTER LITERAL: (" << lexer.Text()[1] << ")\n";
             break;
 
         case TokenType::TOK_STRING_LITERAL:
-            std::cout << "STRING LITERAL: (" << strVal << ")\n";
+            {
+                const StringLiteral &s = std::get<StringLiteral>(lexer.Payload());
+                std::cout << "STRING LITERAL: (" << TokenStream::StringValue(source.Text(s.offset, s.length), s.escaped) << ")\n";
+            }
             break;
 
         case TokenType::TOK_PRAGMA_NAME:
-            std::cout << "PRAGMA DIRECTIVE: " << yytext << '\n';
+            std::cout << "PRAGMA DIRECTIVE: " << lexer.Text() << '\n';
             break;
 
         case TokenType::TOK_ERROR:
@@ -203,10 +211,9 @@ static int Scan(std::string filename)
             std::cerr << "Unknown Token Type: " << (int)tok << '\n'; break;
         }
 
-        tok = yylex();
+        tok = lexer.Next();
     }
 
-
     return EXIT_SUCCESS;
 }
 
@@ -227,23 +234,222 @@ static int Tokenize(std::string filename)
 
 
 //
-// -- Properly Compile the source
-//    ---------------------------
-static int Compile(std::string filename, ParseType_t type)
+// -- Do 2 payloads of the same kind of token hold the same value?
+//    ------------------------------------------------------------
+static bool SamePayload(TokenType tok, const YYSTYPE &a, const YYSTYPE &b)
 {
-    tokens = new TokenStream(filename.c_str());
-    Parser *parser = new Parser(*tokens);
-    diags.SetParser(parser);
-    int cnt = 0;
-    int rv = EXIT_SUCCESS;
+    switch (tok) {
+    case TokenType::TOK_IDENTIFIER:
+        return std::get<IdentifierLexeme>(a).name == std::get<IdentifierLexeme>(b).name;
+
+    case TokenType::TOK_UNIVERSAL_INT_LITERAL:
+        return literals.Integer(std::get<NumericLiteral>(a).index)
+                == literals.Integer(std::get<NumericLiteral>(b).index);
+
+    case TokenType::TOK_UNIVERSAL_REAL_LITERAL:
+        return literals.Real(std::get<NumericLiteral>(a).index)
+                == literals.Real(std::get<NumericLiteral>(b).index);
+
+    case TokenType::TOK_CHARACTER_LITERAL:
+        return std::get<CharLiteral>(a).offset == std::get<CharLiteral>(b).offset
+                && std::get<CharLiteral>(a).value == std::get<CharLiteral>(b).value;
+
+    case TokenType::TOK_STRING_LITERAL:
+        return std::get<StringLiteral>(a).offset == std::get<StringLiteral>(b).offset
+                && std::get<StringLiteral>(a).length == std::get<StringLiteral>(b).length
+                && std::get<StringLiteral>(a).escaped == std::get<StringLiteral>(b).escaped;
+
+    default:
+        return true;
+    }
+}
+
+
+
+//
+// -- Run both lexers over the source and compare the tokens they produce
+//    -------------------------------------------------------------------
+static int LexDiff(std::string filename)
+{
+    using Lexed_t = struct Lexed_t {
+        TokenType tok;
+        uint32_t offset;
+        uint32_t line;
+        uint32_t column;
+        YYSTYPE payload;
+    };
+
+    FILE *fp = fopen(filename.c_str(), "r");
+    if (!fp) {
+        std::cerr << "Unable to open file " << filename << '\n';
+        return EXIT_FAILURE;
+    }
+    fclose(fp);
+
+    SourceFile source(filename.c_str());
+    std::vector<Lexed_t> lexed[2];
+    Lexer::Kind kinds[2] = { Lexer::Kind::Flex, Lexer::Kind::Fast };
+
+
+    //
+    // -- the flex scanner modifies the buffer as it goes, so each lexer runs to the end on its own
+    //    -----------------------------------------------------------------------------------------
+    for (int i = 0; i < 2; i ++) {
+        std::unique_ptr<Lexer> lexer = Lexer::Create(kinds[i], source);
+        TokenType tok;
+
+        do {
+            tok = lexer->Next();
+            lexed[i].push_back({ tok, lexer->Offset(), lexer->Line(), lexer->Column(),
+                    TokenStream::HasPayload(tok) ? lexer->Payload() : YYSTYPE {} });
+        } while ((int)tok);
+    }
+
+
+    //
+    // -- now compare them token by token
+    //    -------------------------------
+    size_t count = std::min(lexed[0].size(), lexed[1].size());
+
+    for (size_t i = 0; i < count; i ++) {
+        const Lexed_t &a = lexed[0][i];
+        const Lexed_t &b = lexed[1][i];
+        bool same = a.tok == b.tok && a.line == b.line && a.column == b.column
+                && (a.tok == TokenType::YYEOF || a.offset == b.offset)
+                && a.payload.index() == b.payload.index();
+
+        if (same) same = SamePayload(a.tok, a.payload, b.payload);
+
+        if (!same) {
+            std::cout << filename << ": token " << i + 1 << " differs\n";
+            std::cout << "    flex: " << (int)a.tok << " at offset " << a.offset << " (" << a.line << ',' << a.column << ")\n";
+            std::cout << "    fast: " << (int)b.tok << " at offset " << b.offset << " (" << b.line << ',' << b.column << ")\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (lexed[0].size() != lexed[1].size()) {
+        std::cout << filename << ": token counts differ (" << lexed[0].size() << " vs " << lexed[1].size() << ")\n";
+        return EXIT_FAILURE;
+    }
+
+    std::cout << filename << ": " << count << " tokens match\n";
+    return EXIT_SUCCESS;
+}
+
+
+
+//
+// -- Make a series of edits throughout the source, lexing again only what changed, and after each
+//    one compare the token stream with one lexed from scratch over the edited text
+//    ----------------------------------------------------------------------------------------------
+static int EditDiff(std::string filename)
+{
+    using Edit_t = struct Edit_t {
+        uint32_t removed;
+        const char *text;
+    };
+
+    static const Edit_t edits[] = {
+        { 0, "x" },
+        { 1, "" },
+        { 0, "\n" },
+        { 0, "\"" },
+        { 0, " pragma P (" },
+        { 0, " and" },
+        { 0, " then " },
+        { 0, "--" },
+        { 3, "\r\n" },
+        { 0, "'a'" },
+        { 0, " 1.5e3 " },
+        { 5, "" },
+    };
+    const int kinds = sizeof(edits) / sizeof(edits[0]);
+    const int count = 3 * kinds;
+
+    FILE *fp = fopen(filename.c_str(), "r");
+    if (!fp) {
+        std::cerr << "Unable to open file " << filename << '\n';
+        return EXIT_FAILURE;
+    }
+    fclose(fp);
+
+    TokenStream ts(filename.c_str());
+    SourceFile original(filename.c_str());
+    std::string text(original.Buffer(), original.Size());
+
+    for (int e = 0; e < count; e ++) {
+        const Edit_t &edit = edits[e % kinds];
+        uint32_t offset = (uint64_t)text.size() * (2 * e + 1) / (2 * count);
+        uint32_t removed = std::min(edit.removed, (uint32_t)text.size() - offset);
+
+        ts.Edit(offset, removed, edit.text);
+        text.replace(offset, removed, edit.text);
+
+
+        //
+        // -- lex the edited text from scratch
+        //    --------------------------------
+        char name[] = "/tmp/ada-editdiff-XXXXXX";
+        int fd = mkstemp(name);
+
+        if (fd < 0 || write(fd, text.data(), text.size()) != (ssize_t)text.size()) {
+            std::cerr << "Unable to write a temporary file\n";
+            return EXIT_FAILURE;
+        }
+
+        close(fd);
+        TokenStream fresh(name);
+        unlink(name);
+
+
+        //
+        // -- and compare the two
+        //    -------------------
+        if (ts.Count() != fresh.Count()) {
+            std::cout << filename << ": after edit " << e + 1 << " at offset " << offset
+                    << ", token counts differ (" << ts.Count() << " vs " << fresh.Count() << ")\n";
+            return EXIT_FAILURE;
+        }
+
+        for (int i = 0; i < (int)fresh.Count(); i ++) {
+            ts.Reset(i);
+            fresh.Reset(i);
+
+            bool same = ts.Current() == fresh.Current() && ts.Offset() == fresh.Offset()
+                    && ts.LineNo() == fresh.LineNo() && ts.Column() == fresh.Column()
+                    && ts.Payload().index() == fresh.Payload().index()
+                    && SamePayload(ts.Current(), ts.Payload(), fresh.Payload());
+
+            if (!same) {
+                std::cout << filename << ": after edit " << e + 1 << " at offset " << offset
+                        << ", token " << i + 1 << " differs\n";
+                std::cout << "    edited: " << (int)ts.Current() << " at offset " << ts.Offset()
+                        << " (" << ts.LineNo() << ',' << ts.Column() << ")\n";
+                std::cout << "    fresh:  " << (int)fresh.Current() << " at offset " << fresh.Offset()
+                        << " (" << fresh.LineNo() << ',' << fresh.Column() << ")\n";
+                return EXIT_FAILURE;
+            }
+        }
+    }
+
+    std::cout << filename << ": " << count << " edits match\n";
+    return EXIT_SUCCESS;
+}
 
+
+
+//
+// -- Parse the source as asked
+//    -------------------------
+static int Parse(Parser *parser, ParseType_t type)
+{
     switch (type) {
     case COMPILE_TYPES:
         while (tokens->Current() != TokenType::YYEOF) {
             if(!parser->ParseBasicDeclaration()) {
                 std::cerr << "\e[31;1mERROR: Unable to properly parse Basic Declaration\e[0m\n";
-                rv = EXIT_FAILURE;
-                goto exit;
+                return EXIT_FAILURE;
             } else {
 //                std::cerr << "Completed a Declaration\n";
             }
@@ -260,15 +466,13 @@ static int Compile(std::string filename, ParseType_t type)
         std::cerr << "********************************\n\n";
         if(!parser->ParseExpression()) {
             std::cerr << "\n\e[31;1mERROR: Unable to properly parse Expression\e[0m\n";
-            rv = EXIT_FAILURE;
-            goto exit;
+            return EXIT_FAILURE;
         }
 
         std::cerr << "next token " << tokens->tokenStr(tokens->Current()) << '\n';
         if (tokens->Current() != TokenType::YYEOF) {
             std::cerr << "\n\e[31;1mERROR: Extra input in Expression parse\e[0m\n";
-            rv = EXIT_FAILURE;
-            goto exit;
+            return EXIT_FAILURE;
         }
 
         break;
@@ -279,10 +483,70 @@ static int Compile(std::string filename, ParseType_t type)
     }
 
     std::cerr << "Parse Complete.\n";
+    return EXIT_SUCCESS;
+}
+
+
+
+//
+// -- The parser recurses a few frames deeper for each level an expression is nested, so it runs on a
+//    thread with a stack big enough for the deepest nesting allowed by `--max-nesting`
+//    ------------------------------------------------------------------------------------------------
+static const size_t ParseStackBase = 8 << 20;
+static const size_t ParseStackPerNesting = 8 << 10;
+
+static int ParseOnStack(Parser *parser, ParseType_t type)
+{
+    using Job_t = struct Job_t {
+        Parser *parser;
+        ParseType_t type;
+        int rv;
+    };
+
+    Job_t job = { parser, type, EXIT_FAILURE };
+    pthread_attr_t attr;
+    pthread_t thread;
+
+    auto run = [](void *arg) -> void * {
+        Job_t *j = (Job_t *)arg;
+        j->rv = Parse(j->parser, j->type);
+        return nullptr;
+    };
+
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, ParseStackBase + opts.maxNesting * ParseStackPerNesting);
+
+    if (pthread_create(&thread, &attr, run, &job) == 0) {
+        pthread_join(thread, nullptr);
+    } else {
+        job.rv = Parse(parser, type);
+    }
+
+    pthread_attr_destroy(&attr);
+    return job.rv;
+}
+
+
+
+//
+// -- Properly Compile the source
+//    ---------------------------
+static int Compile(std::string filename, ParseType_t type)
+{
+    tokens = new TokenStream(filename.c_str());
+    Parser *parser = new Parser(*tokens);
+    diags.SetParser(parser);
+
+    int rv = ParseOnStack(parser, type);
 
-exit:
     if (opts.listing) tokens->Listing();
     if (opts.dumpSymtab) parser->Scopes()->Print();
+    if (opts.dumpAST) parser->Tree()->Print();
+    if (opts.parseProfile) parser->Profile()->Print();
+
+    if (!opts.parseProfileJson.empty() && !parser->Profile()->Json(opts.parseProfileJson)) {
+        std::cerr << "Unable to write the parse profile to " << opts.parseProfileJson << '\n';
+    }
 
     std::cerr << "   Errors  : " << diags.Errors() << '\n';
     std::cerr << "   Warnings: " << diags.Warnings() << '\n';
@@ -305,6 +569,9 @@ static void Usage(std::string pgm)
     std::cout << "      scan            scan the file and normalize what is read\n";
     std::cout << "      tokenize        read the file into a token stream and output\n";
     std::cout << "                      the token stream and the source listing\n";
+    std::cout << "      lexdiff         run both lexers over the file and compare their tokens\n";
+    std::cout << "      editdiff        edit the file in memory, lexing only what changed, and compare the\n";
+    std::cout << "                      tokens with lexing the edited text from scratch\n";
     std::cout << "      declarations, types\n";
     std::cout << "                      process only declarations parts of the parser\n";
     std::cout << "      expressions, expr\n";
@@ -314,14 +581,31 @@ static void Usage(std::string pgm)
     std::cout << "  -h, --help          print this screen and exit\n";
     std::cout << "  -t, --trace         output production tracing\n";
     std::cout << "      --dump-symtab   dump the symbol table contents before exiting\n";
+    std::cout << "      --dump-ast      dump the syntax tree built by the parser before exiting\n";
     std::cout << "      --listing       produce a listing before exiting\n";
+    std::cout << "      --lexer=flex    use the flex scanner (the default)\n";
+    std::cout << "      --lexer=fast    use the hand-written lexer\n";
+    std::cout << "      --stream-tokens lex tokens only as the parser needs them, keeping only those it can\n";
+    std::cout << "                      still back up to\n";
+    std::cout << "      --packrat       remember the outcome of productions which are backtracked over, and\n";
+    std::cout << "                      replay it when they are tried again at the same token\n";
+    std::cout << "      --lex-jobs=N    lex big files in chunks on N threads (default: one per processor)\n";
+    std::cout << "      --chunked-lex-size=BYTES\n";
+    std::cout << "                      the smallest file which is lexed in chunks (default: 4 MiB)\n";
+    std::cout << "      --parse-profile print a table of the work done in each production before exiting\n";
+    std::cout << "      --parse-profile=FILE\n";
+    std::cout << "                      as --parse-profile, and also write the table to FILE as JSON\n";
+    std::cout << "      --max-nesting=N how deeply expressions may be nested in one another (default: 256)\n";
+    std::cout << "      --token-cache=DIR\n";
+    std::cout << "                      save the tokens of each file in DIR and load them from there when\n";
+    std::cout << "                      the file has not changed\n";
     std::cout << "\n";
 
     exit(EXIT_SUCCESS);
 }
 
 
-#include <unistd.h>
+
 //
 // -- The main entry point
 //    --------------------
@@ -331,6 +615,8 @@ int main(int argc, char *argv[])
         ACT_COMPILE,
         ACT_SCAN,
         ACT_TOKENIZE,
+        ACT_LEXDIFF,
+        ACT_EDITDIFF,
     } action = ACT_COMPILE;
     std::string filename = "";
     ParseType_t type = COMPILE_FULL;
@@ -352,11 +638,67 @@ int main(int argc, char *argv[])
             continue;
         }
 
+        if (arg == "--dump-ast") {
+            opts.dumpAST = true;
+            continue;
+        }
+
         if (arg == "--listing") {
             opts.listing = true;
             continue;
         }
 
+        if (arg == "--lexer=flex") {
+            opts.fastLexer = false;
+            continue;
+        }
+
+        if (arg == "--lexer=fast") {
+            opts.fastLexer = true;
+            continue;
+        }
+
+        if (arg == "--stream-tokens") {
+            opts.streamTokens = true;
+            continue;
+        }
+
+        if (arg == "--packrat") {
+            opts.packrat = true;
+            continue;
+        }
+
+        if (arg.rfind("--lex-jobs=", 0) == 0) {
+            opts.lexJobs = std::stoul(arg.substr(11));
+            continue;
+        }
+
+        if (arg.rfind("--chunked-lex-size=", 0) == 0) {
+            opts.chunkedLexSize = std::stoul(arg.substr(19));
+            continue;
+        }
+
+        if (arg == "--parse-profile") {
+            opts.parseProfile = true;
+            continue;
+        }
+
+        if (arg.rfind("--parse-profile=", 0) == 0) {
+            opts.parseProfile = true;
+            opts.parseProfileJson = arg.substr(16);
+            continue;
+        }
+
+        if (arg.rfind("--max-nesting=", 0) == 0) {
+            opts.maxNesting = std::stoul(arg.substr(14));
+            continue;
+        }
+
+        if (arg.rfind("--token-cache=", 0) == 0) {
+            opts.tokenCache = arg.substr(14);
+            continue;
+        }
+
         if (arg == "scan") {
             action = ACT_SCAN;
             continue;
@@ -367,6 +709,16 @@ int main(int argc, char *argv[])
             continue;
         }
 
+        if (arg == "lexdiff") {
+            action = ACT_LEXDIFF;
+            continue;
+        }
+
+        if (arg == "editdiff") {
+            action = ACT_EDITDIFF;
+            continue;
+        }
+
         if (arg == "declarations" || arg == "types") {
             action = ACT_COMPILE;
             type = COMPILE_TYPES;
@@ -392,6 +744,12 @@ int main(int argc, char *argv[])
     case ACT_TOKENIZE:
         return Tokenize(filename);
 
+    case ACT_LEXDIFF:
+        return LexDiff(filename);
+
+    case ACT_EDITDIFF:
+        return EditDiff(filename);
+
     default:
         return Compile(filename, type);
     }
@@ -18,9 +18,171 @@
 
 
 //
-// -- This statically declaraed member in the Mark class needs a physical memory location
-//    -----------------------------------------------------------------------------------
-int Parser::MarkStream::depth = 0;
+// -- Consume the current token, keeping it in the tree as a leaf with its value
+//    --------------------------------------------------------------------------
+void Parser::Token(void)
+{
+    TokenType tok = tokens.Current();
+    int at = tokens.Location();
+    NodeKind kind = NodeKind::Keyword;
+    uint32_t value = 0;
 
+    switch (tok) {
+    case TokenType::TOK_IDENTIFIER:
+        kind = NodeKind::Identifier;
+        value = std::get<IdentifierLexeme>(tokens.Payload()).name;
+        break;
 
+    case TokenType::TOK_CHARACTER_LITERAL:
+        kind = NodeKind::CharacterLiteral;
+        value = std::get<CharLiteral>(tokens.Payload()).value;
+        break;
 
+    case TokenType::TOK_UNIVERSAL_INT_LITERAL:
+        kind = NodeKind::IntegerLiteral;
+        value = std::get<NumericLiteral>(tokens.Payload()).index;
+        break;
+
+    case TokenType::TOK_UNIVERSAL_REAL_LITERAL:
+        kind = NodeKind::RealLiteral;
+        value = std::get<NumericLiteral>(tokens.Payload()).index;
+        break;
+
+    case TokenType::TOK_STRING_LITERAL:
+        kind = NodeKind::StringLiteral;
+        value = ast.AddString(std::get<StringLiteral>(tokens.Payload()));
+        break;
+
+    case TokenType::TOK_NULL:
+        kind = NodeKind::Null;
+        break;
+
+    default:
+        break;
+    }
+
+    ast.Leaf(kind, tok, tokens.SourceLocation(), value, at, at + 1);
+    tokens.Advance();
+}
+
+
+
+
+
+
+//
+// -- Parse a production through the packrat memo.  A production which is backtracked over is parsed
+//    again from the same token by the next alternative; when the symbol table has not changed in
+//    between, the outcome is the same, so it is replayed from the memo instead: the stream is moved
+//    to where the production ended, the tree it built is built again and its diagnostics are queued
+//    again under the current stack.
+//
+//    Only outcomes reached under a mark are kept, since only those can be parsed a second time, and
+//    only when parsing the production left the symbol table as it was.
+//    ----------------------------------------------------------------------------------------------
+bool Parser::Memoize(MemoRule rule, bool (Parser::*body)(void))
+{
+    if (!opts.packrat) return (this->*body)();
+
+    int start = tokens.Location();
+    uint64_t key = ((uint64_t)start << 8) | (uint64_t)rule;
+    uint64_t epoch = scopes.Epoch();
+
+    auto it = memo.find(key);
+    if (it != memo.end() && it->second.epoch == epoch) {
+        const Memo_t &m = it->second;
+
+        tokens.Reset(m.end);
+        ast.Replay(m.tree);
+        for (const Diagnostics::Saved_t &msg : m.msgs) diags.Replay(msg);
+        diags.Errors() += m.errors;
+        diags.Warnings() += m.warnings;
+
+        return m.ok;
+    }
+
+
+    bool record = journal.Depth() > 0 && depth < MaxProductionDepth;
+    size_t chkpt = diags.Checkpoint();
+    AST::Checkpoint_t treeChkpt = ast.Checkpoint();
+    int errors = diags.Errors();
+    int warnings = diags.Warnings();
+    int outer = depth;
+
+    bool rv = (this->*body)();
+
+    if (!record || scopes.Epoch() != epoch) return rv;
+
+    Memo_t m = { epoch, rv, tokens.Location(), diags.Errors() - errors, diags.Warnings() - warnings, {}, {} };
+    if (!diags.Since(chkpt, outer, m.msgs)) return rv;
+    if (!ast.Since(treeChkpt, m.tree)) return rv;
+
+    memo[key] = std::move(m);
+
+    return rv;
+}
+
+
+
+//
+// -- Classify the name `name`, read from the identifier at `token`, from the cache when the symbol
+//    table has not changed since it was last classified there
+//    ---------------------------------------------------------------------------------------------
+Parser::NameClass_t Parser::Classify(int token, Atom_t name)
+{
+    NameSlot_t &slot = names[(unsigned)token % NameCacheSize];
+    uint64_t epoch = scopes.Epoch();
+
+    if (slot.token == token && slot.name == name && slot.epoch == epoch) return slot.cls;
+
+    NameClass_t cls {};
+    const std::vector<Symbol *> *vec = scopes.Lookup(name);
+
+    if (vec) {
+        for (Symbol *sym : *vec) {
+            switch (sym->kind) {
+            case Symbol::SymbolKind::Type:
+                cls.type = true;
+                if (static_cast<TypeSymbol *>(sym)->category == TypeSymbol::TypeCategory::Subtype) cls.subtype = true;
+                break;
+
+            case Symbol::SymbolKind::IncompleteType:    cls.incomplete = true;      break;
+            case Symbol::SymbolKind::Subprogram:        cls.subprogram = true;      break;
+            case Symbol::SymbolKind::Component:         cls.component = true;       break;
+            case Symbol::SymbolKind::Object:            cls.object = true;          break;
+            case Symbol::SymbolKind::Deleted:           continue;
+            default:                                                                break;
+            }
+
+            cls.known = true;
+        }
+    }
+
+    slot = NameSlot_t { token, name, epoch, cls };
+    return slot.cls;
+}
+
+
+
+//
+// -- The memoized productions: each parses its body through the memo
+//    ---------------------------------------------------------------
+bool Parser::ParseAggregate(void) { return Memoize(MemoRule::Aggregate, &Parser::ParseAggregate_Body); }
+bool Parser::ParseChoice(void) { return Memoize(MemoRule::Choice, &Parser::ParseChoice_Body); }
+bool Parser::ParseComponentAssociation(void) {
+    return Memoize(MemoRule::ComponentAssociation, &Parser::ParseComponentAssociation_Body);
+}
+bool Parser::ParseConstraint(void) { return Memoize(MemoRule::Constraint, &Parser::ParseConstraint_Body); }
+bool Parser::ParseDiscreteRange(void) { return Memoize(MemoRule::DiscreteRange, &Parser::ParseDiscreteRange_Body); }
+bool Parser::ParseExpression(void) { return Memoize(MemoRule::Expression, &Parser::ParseExpression_Body); }
+bool Parser::ParseFactor(void) { return Memoize(MemoRule::Factor, &Parser::ParseFactor_Body); }
+bool Parser::ParsePrimary(void) { return Memoize(MemoRule::Primary, &Parser::ParsePrimary_Body); }
+bool Parser::ParseRange(void) { return Memoize(MemoRule::Range, &Parser::ParseRange_Body); }
+bool Parser::ParseRelation(void) { return Memoize(MemoRule::Relation, &Parser::ParseRelation_Body); }
+bool Parser::ParseSimpleExpression(void) {
+    return Memoize(MemoRule::SimpleExpression, &Parser::ParseSimpleExpression_Body);
+}
+bool Parser::ParseSubtypeIndication(void) {
+    return Memoize(MemoRule::SubtypeIndication, &Parser::ParseSubtypeIndication_Body);
+}
+bool Parser::ParseTerm(void) { return Memoize(MemoRule::Term, &Parser::ParseTerm_Body); }
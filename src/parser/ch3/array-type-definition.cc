@@ -24,7 +24,7 @@
 //    ------------------------------
 bool Parser::ParseArrayTypeDefinition(Id &id)
 {
-    Production p(*this, "array_type_definition");
+    Production p(*this, ProdID::ArrayTypeDefinition);
 
     if (ParseUnconstrainedArrayDefinition(id))    return true;
     if (ParseConstrainedArrayDefinition(id))      return true;
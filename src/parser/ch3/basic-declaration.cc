@@ -54,14 +54,20 @@
 bool Parser::ParseBasicDeclaration(void)
 {
     // -- This top-level production must Mark its location so it can output diags
-    MarkStream m(tokens, diags);
-    Production p(*this, "basic_declaration");
+    MarkStream m(journal);
+    Production p(*this, ProdID::BasicDeclaration);
     SourceLoc_t loc = tokens.SourceLocation();
+    TokenType tok = tokens.Current();
 
-    if (ParseObjectDeclaration())            { m.Commit(); return true; }
-    if (ParseNumberDeclaration())            { m.Commit(); return true; }
-    if (ParseTypeDeclaration())              { m.Commit(); return true; }
-    if (ParseSubtypeDeclaration())           { m.Commit(); return true; }
+
+    //
+    // -- Only try the alternatives which can begin with this token; an identifier is the only
+    //    token which begins more than one of them
+    //    ------------------------------------------------------------------------------------
+    if (First(ProdID::ObjectDeclaration, tok) && ParseObjectDeclaration())      { m.Commit(); return true; }
+    if (First(ProdID::NumberDeclaration, tok) && ParseNumberDeclaration())      { m.Commit(); return true; }
+    if (First(ProdID::TypeDeclaration, tok) && ParseTypeDeclaration())          { m.Commit(); return true; }
+    if (First(ProdID::SubtypeDeclaration, tok) && ParseSubtypeDeclaration())    { m.Commit(); return true; }
     if (ParseSubprogramDeclaration())        { m.Commit(); return true; }
     if (ParsePackageDeclaration())           { m.Commit(); return true; }
     if (ParseTaskDeclaration())              { m.Commit(); return true; }
@@ -26,7 +26,7 @@
 //    ------------------------------
 bool Parser::ParseBasicDeclarativeItem(void)
 {
-    Production p(*this, "basic_declarative_item");
+    Production p(*this, ProdID::BasicDeclarativeItem);
 
     if (ParseBasicDeclaration())        return true;
     if (ParseRepresentationClause())    return true;
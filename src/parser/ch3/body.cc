@@ -24,7 +24,7 @@
 //    ------------
 bool Parser::ParseBody(void)
 {
-    Production p(*this, "body");
+    Production p(*this, ProdID::Body);
 
     if (ParseProperBody())  return true;
     if (ParseBodyStub())    return true;
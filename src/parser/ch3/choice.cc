@@ -28,10 +28,10 @@
 //
 // -- Parse a Choice
 //    --------------
-bool Parser::ParseChoice(void)
+bool Parser::ParseChoice_Body(void)
 {
-    Production p(*this, "choice");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::Choice);
+    MarkStream m(journal);
     Id id;
 
 
@@ -40,7 +40,7 @@ bool Parser::ParseChoice(void)
     //    happen before the simpler ones which may consume fewer tokens -- other than
     //    the trivial deterministic options, where were placed first.
     //    ----------------------------------------------------------------------------
-    if (Optional(TokenType::TOK_OTHERS)) {
+    if (OptionalLeaf(TokenType::TOK_OTHERS)) {
         m.Commit();
         return true;
     }
@@ -50,20 +50,16 @@ bool Parser::ParseChoice(void)
         return true;
     }
 
+    int at = tokens.Location();
     if (ParseSimpleName(id)) {
         //
         // -- This is required to be a component simple name
         //
         //    TODO: Check the type of the simple name
         //    ----------------------------------------------
-        const std::vector<Symbol *> *vec = scopes.Lookup(id.name);
-        if (vec != nullptr) {
-            for (auto &sym : *vec) {
-                if (sym->kind == Symbol::SymbolKind::Component) {
-                    m.Commit();
-                    return true;
-                }
-            }
+        if (Classify(at, id.name).component) {
+            m.Commit();
+            return true;
         }
 
         m.Reset();
@@ -24,9 +24,8 @@
 //    -----------------------------
 bool Parser::ParseComponentDeclaration(RecordTypeSymbol *rec)
 {
-    Production p(*this, "component_declaration");
-    MarkStream m(tokens, diags);
-    MarkScope s(scopes);
+    Production p(*this, ProdID::ComponentDeclaration);
+    MarkStream m(journal);
     std::unique_ptr<IdList> idList = std::make_unique<IdList>();
     SourceLoc_t loc;
 
@@ -69,7 +68,6 @@ bool Parser::ParseComponentDeclaration(RecordTypeSymbol *rec)
     //
     // -- Consider this parse to be good
     //    ------------------------------
-    s.Commit();
     m.Commit();
     return true;
 }
@@ -26,10 +26,12 @@
 //    ----------------------
 bool Parser::ParseComponentList(RecordTypeSymbol *rec)
 {
-    Production p(*this, "component_list");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::ComponentList);
+    MarkStream m(journal);
     SourceLoc_t loc;
 
+    p.Keep();       // -- a list of one is still a list
+
 
 
     //
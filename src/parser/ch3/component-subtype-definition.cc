@@ -24,7 +24,7 @@
 //    ------------------------------------
 bool Parser::ParseComponentSubtypeDefinition(void)
 {
-    Production p(*this, "component_subtype_definition");
+    Production p(*this, ProdID::ComponentSubtypeDefinition);
 
     if (ParseSubtypeIndication())   return true;
 
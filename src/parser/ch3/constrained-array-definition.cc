@@ -44,9 +44,8 @@ bool Parser::_HelpParseConstrainedArrayDefinition(void)
 //    ------------------------------------
 bool Parser::ParseConstrainedArrayDefinition(Id &id)
 {
-    Production p(*this, "constrained_array_definition (id)");
-    MarkStream m(tokens, diags);
-    MarkScope s(scopes);
+    Production p(*this, ProdID::ConstrainedArrayDefinitionId);
+    MarkStream m(journal);
     std::vector<Symbol *> *vec;
     bool updateIncomplete = false;
 
@@ -55,14 +54,14 @@ bool Parser::ParseConstrainedArrayDefinition(Id &id)
     //
     // -- Manage the symbol table
     //    -----------------------
-    if (scopes.IsLocalDefined(std::string_view(id.name))) {
+    if (scopes.IsLocalDefined(id.name)) {
         // -- name is used in this scope is it a singleton and incomplete class?
-        vec = scopes.CurrentScope()->LocalLookup(std::string_view(id.name));
+        vec = scopes.CurrentScope()->LocalLookup(id.name);
 
         if (vec->size() == 1 && vec->at(0)->kind == Symbol::SymbolKind::IncompleteType) {
             updateIncomplete = true;
         } else {
-            diags.Error(id.loc, DiagID::DuplicateName, { id.name } );
+            diags.Error(id.loc, DiagID::DuplicateName, { atoms.Spelling(id.name) } );
         }
     }
 
@@ -77,8 +76,7 @@ bool Parser::ParseConstrainedArrayDefinition(Id &id)
     //
     // -- Consider this parse to be good
     //    ------------------------------
-    if (updateIncomplete) vec->at(0)->kind = Symbol::SymbolKind::Deleted;
-    s.Commit();
+    if (updateIncomplete) scopes.Retire(vec->at(0));
     m.Commit();
     return true;
 }
@@ -91,9 +89,8 @@ bool Parser::ParseConstrainedArrayDefinition(Id &id)
 //    ------------------------------------
 bool Parser::ParseConstrainedArrayDefinition(IdList *list)
 {
-    Production p(*this, "constrained_array_definition (list)");
-    MarkStream m(tokens, diags);
-    MarkScope s(scopes);
+    Production p(*this, ProdID::ConstrainedArrayDefinitionList);
+    MarkStream m(journal);
 
 
 
@@ -112,7 +109,6 @@ bool Parser::ParseConstrainedArrayDefinition(IdList *list)
     //
     // -- Consider this parse to be good
     //    ------------------------------
-    s.Commit();
     m.Commit();
     return true;
 }
@@ -26,16 +26,19 @@
 //
 // -- Parse a Constraint
 //    ------------------
-bool Parser::ParseConstraint(void)
+bool Parser::ParseConstraint_Body(void)
 {
-    Production p(*this, "constraint");
+    Production p(*this, ProdID::Constraint);
     Id id;
+    TokenType tok = tokens.Current();
 
-    if (ParseRangeConstraint())             return true;
-    if (ParseFloatingPointConstraint(id))   return true;
-    if (ParseFixedPointConstraint(id))      return true;
-    if (ParseIndexConstraint())             return true;
-    if (ParseDiscriminantConstraint())      return true;
+    if (First(ProdID::RangeConstraint, tok))            return ParseRangeConstraint();
+    if (First(ProdID::FloatingPointConstraint, tok))    return ParseFloatingPointConstraint(id);
+    if (First(ProdID::FixedPointConstraint, tok))       return ParseFixedPointConstraint(id);
+
+    // -- these both begin with a '(', so they are tried in turn
+    if (First(ProdID::IndexConstraint, tok) && ParseIndexConstraint())                  return true;
+    if (First(ProdID::DiscriminantConstraint, tok) && ParseDiscriminantConstraint())    return true;
 
     return false;
 }
@@ -24,9 +24,10 @@
 //    ------------------------
 bool Parser::ParseDeclarativePart(void)
 {
-    Production p(*this, "declarative_part");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::DeclarativePart);
+    MarkStream m(journal);
 
+    p.Keep();       // -- a list of one is still a list
 
 
     //
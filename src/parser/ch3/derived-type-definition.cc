@@ -24,9 +24,8 @@
 //    -------------------------------
 bool Parser::ParseDerivedTypeDefinition(Id &id)
 {
-    Production p(*this, "derived_type_definition");
-    MarkStream m(tokens, diags);
-    MarkScope s(scopes);
+    Production p(*this, ProdID::DerivedTypeDefinition);
+    MarkStream m(journal);
     std::vector<Symbol *> *vec;
     bool updateIncomplete = false;
 
@@ -40,14 +39,14 @@ bool Parser::ParseDerivedTypeDefinition(Id &id)
     //
     // -- Manage the symbol table
     //    -----------------------
-    if (scopes.IsLocalDefined(std::string_view(id.name))) {
+    if (scopes.IsLocalDefined(id.name)) {
         // -- name is used in this scope is it a singleton and incomplete class?
-        vec = scopes.CurrentScope()->LocalLookup(std::string_view(id.name));
+        vec = scopes.CurrentScope()->LocalLookup(id.name);
 
         if (vec->size() == 1 && vec->at(0)->kind == Symbol::SymbolKind::IncompleteType) {
             updateIncomplete = true;
         } else {
-            diags.Error(id.loc, DiagID::DuplicateName, { id.name } );
+            diags.Error(id.loc, DiagID::DuplicateName, { atoms.Spelling(id.name) } );
         }
     }
 
@@ -61,8 +60,7 @@ bool Parser::ParseDerivedTypeDefinition(Id &id)
     //
     // -- Consider this parse to be good
     //    ------------------------------
-    if (updateIncomplete) vec->at(0)->kind = Symbol::SymbolKind::Deleted;
-    s.Commit();
+    if (updateIncomplete) scopes.Retire(vec->at(0));
     m.Commit();
     return true;
 }
@@ -5,6 +5,12 @@
 //
 //  discrete_range ::= discrete_subtype_indication | range
 //
+//  Inside parentheses a discrete range cannot be told from an expression until after its first simple
+//  expression: `A(1 .. N)` is a slice and `A(1 + N)` an index, and `(1 .. N => 0)` is a choice where
+//  `(1 + N, 0)` is a positional aggregate.  So the callers there parse the two together, once.  Only a
+//  type name followed by `range` (or by what can end a choice) is a subtype indication; anything else
+//  is a simple expression, which becomes a range when `..` follows it.
+//
 // ---------------------------------------------------------------------------------------------------------------
 //
 //     Date      Tracker  Version  Pgmr  Description
@@ -22,9 +28,9 @@
 //
 // -- Parse Discrete Range
 //    --------------------
-bool Parser::ParseDiscreteRange(void)
+bool Parser::ParseDiscreteRange_Body(void)
 {
-    Production p(*this, "discrete_range");
+    Production p(*this, ProdID::DiscreteRange);
 
     if (ParseDiscreteSubtypeIndication())   return true;
     if (ParseRange())                       return true;
@@ -34,3 +40,52 @@ bool Parser::ParseDiscreteRange(void)
 
 
 
+//
+// -- Parse a discrete range or a simple expression, whichever it turns out to be, without going back
+//    over the first simple expression; `range` is set when it was a discrete range.  In a `choice`
+//    a type name may be followed by `|` or `=>`; elsewhere (a slice) by `)`.
+//    ----------------------------------------------------------------------------------------------
+bool Parser::ParseDiscreteRange_OrSimpleExpression(bool &range, bool choice)
+{
+    size_t first = ast.Pending();
+    int start = tokens.Location();
+    SourceLoc_t loc = tokens.SourceLocation();
+
+    range = false;
+
+    if (tokens.Current() == TokenType::TOK_IDENTIFIER) {
+        IdentifierLexeme idLex = std::get<IdentifierLexeme>(tokens.Payload());
+        NameClass_t cls = Classify(tokens.Location(), idLex.name);
+        TokenType next = tokens.Peek();
+        bool ends = choice ? (next == TokenType::TOK_VERTICAL_BAR || next == TokenType::TOK_ARROW)
+                : next == TokenType::TOK_RIGHT_PARENTHESIS;
+
+        if ((cls.type || cls.incomplete) && (next == TokenType::TOK_RANGE || ends)) {
+            if (ParseDiscreteRange()) {
+                range = true;
+                return true;
+            }
+        }
+    }
+
+    if (!ParseSimpleExpression()) return false;
+    if (tokens.Current() != TokenType::TOK_DOUBLE_DOT) return true;
+
+
+    //
+    // -- A `..` makes it a range, if the upper bound is there; if not, the simple expression stands
+    //    and the `..` is left for the caller to report
+    //    ------------------------------------------------------------------------------------------
+    MarkStream r(journal);
+
+    tokens.Advance();
+    if (!ParseSimpleExpression()) return true;
+
+    ast.Wrap(ProdID::Range, loc, first, start, tokens.Location());
+    r.Commit();
+    range = true;
+    return true;
+}
+
+
+
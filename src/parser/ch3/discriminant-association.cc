@@ -24,8 +24,8 @@
 //    --------------------------------
 bool Parser::ParseDiscriminantAssociation(void)
 {
-    Production p(*this, "disriminant_association");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::DiscriminantAssociation);
+    MarkStream m(journal);
     std::vector<Symbol *> *vec = nullptr;
     Id id;
     SourceLoc_t loc;
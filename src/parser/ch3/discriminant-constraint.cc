@@ -24,8 +24,8 @@
 //    -------------------------------
 bool Parser::ParseDiscriminantConstraint(void)
 {
-    Production p(*this, "discriminant_constraint");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::DiscriminantConstraint);
+    MarkStream m(journal);
     SourceLoc_t loc;
 
 
@@ -24,8 +24,8 @@
 //    -------------------------
 bool Parser::ParseDiscriminantPart(void)
 {
-    Production p(*this, "disctiminant_part");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::DiscriminantPart);
+    MarkStream m(journal);
     SourceLoc_t loc;
 
     if (!Require(TokenType::TOK_LEFT_PARENTHESIS)) return false;
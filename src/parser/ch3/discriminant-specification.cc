@@ -24,9 +24,8 @@
 //    ----------------------------------
 bool Parser::ParseDiscriminantSpecification(void)
 {
-    Production p(*this, "discriminant_specification");
-    MarkStream m(tokens, diags);
-    MarkScope s(scopes);
+    Production p(*this, ProdID::DiscriminantSpecification);
+    MarkStream m(journal);
     std::unique_ptr<IdList> idList = std::make_unique<IdList>();
     SourceLoc_t loc;
 
@@ -68,7 +67,6 @@ bool Parser::ParseDiscriminantSpecification(void)
     //
     // -- Consider this parse to be good
     //    ------------------------------
-    s.Commit();
     m.Commit();
     return true;
 }
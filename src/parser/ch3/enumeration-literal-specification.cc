@@ -24,7 +24,7 @@
 //    ------------------------------------------
 bool Parser::ParseEnumerationLiteralSpecification(EnumTypeSymbol *type)
 {
-    Production p(*this, "enumeration_literal_specification");
+    Production p(*this, ProdID::EnumerationLiteralSpecification);
 
     if (ParseEnumerationLiteral(type)) return true;
 
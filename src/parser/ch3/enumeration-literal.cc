@@ -24,20 +24,20 @@
 //    ----------------------------
 bool Parser::ParseEnumerationLiteral(EnumTypeSymbol *type)
 {
-    Production p(*this, "enumeration_literal");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::EnumerationLiteral);
+    MarkStream m(journal);
     SourceLoc_t loc = tokens.SourceLocation();
     Id id;
     EnumLiteralSymbol *sym;
-    YYSTYPE yy = yylval;      // in case we have a character liteal
 
 
     //
-    // -- Trivially check if it's a character literal
-    //    -------------------------------------------
-    if (Optional(TokenType::TOK_CHARACTER_LITERAL)) {
+    // -- Trivially check if it's a character literal; the payload must be read before the token is consumed
+    //    --------------------------------------------------------------------------------------------------
+    if (tokens.Current() == TokenType::TOK_CHARACTER_LITERAL) {
         std::unique_ptr<EnumLiteralSymbol> sym;
-        id.name = std::get<CharLiteral>(tokens.Payload()).lexeme;
+        id.name = atoms.Intern(tokens.Text(std::get<CharLiteral>(tokens.Payload()).offset, 3));
+        Token();
         sym = std::make_unique<EnumLiteralSymbol>(id.name, type, type->literals.size(), loc, scopes.CurrentScope());
         type->literals.push_back(sym.get());
         scopes.Declare(std::move(sym));
@@ -24,10 +24,9 @@
 //    ------------------------------------
 bool Parser::ParseEnumerationTypeDefinition(Id &id)
 {
-    Production p(*this, "enumeration_type_definition");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::EnumerationTypeDefinition);
+    MarkStream m(journal);
     SourceLoc_t loc;
-    MarkScope s(scopes);
     std::vector<Symbol *> *vec;
     bool updateIncomplete = false;
 
@@ -35,14 +34,14 @@ bool Parser::ParseEnumerationTypeDefinition(Id &id)
     //
     // -- Start by adding a new Enum Type with the name
     //    ---------------------------------------------
-    if (scopes.IsLocalDefined(std::string_view(id.name))) {
+    if (scopes.IsLocalDefined(id.name)) {
         // -- name is used in this scope is it a singleton and incomplete class?
-        vec = scopes.CurrentScope()->LocalLookup(std::string_view(id.name));
+        vec = scopes.CurrentScope()->LocalLookup(id.name);
 
         if (vec->size() == 1 && vec->at(0)->kind == Symbol::SymbolKind::IncompleteType) {
             updateIncomplete = true;
         } else {
-            diags.Error(id.loc, DiagID::DuplicateName, { id.name } );
+            diags.Error(id.loc, DiagID::DuplicateName, { atoms.Spelling(id.name) } );
         }
     }
 
@@ -86,8 +85,7 @@ bool Parser::ParseEnumerationTypeDefinition(Id &id)
     //
     // -- Consider this parse to be good
     //    ------------------------------
-    if (updateIncomplete) vec->at(0)->kind = Symbol::SymbolKind::Deleted;
-    s.Commit();
+    if (updateIncomplete) scopes.Retire(vec->at(0));
     m.Commit();
     return true;
 }
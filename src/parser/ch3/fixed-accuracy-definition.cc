@@ -24,8 +24,8 @@
 //    --------------------------------
 bool Parser::ParseFixedAccuracyDefinition(void)
 {
-    Production(*this, "fixed_accuracy_definition");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::FixedAccuracyDefinition);
+    MarkStream m(journal);
 
     //
     // -- this production starts with a DELTA token
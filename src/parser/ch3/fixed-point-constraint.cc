@@ -24,8 +24,8 @@
 //    ------------------------------
 bool Parser::ParseFixedPointConstraint(Id &id)
 {
-    Production p(*this, "fixed_point_constraint");
-    MarkScope s(scopes);
+    Production p(*this, ProdID::FixedPointConstraint);
+    MarkStream m(journal);
     std::vector<Symbol *> *vec;
     bool updateIncomplete = false;
 
@@ -34,15 +34,15 @@ bool Parser::ParseFixedPointConstraint(Id &id)
     //
     // -- Manage the symbol table
     //    -----------------------
-    if (!id.name.empty()) {
-        if (scopes.IsLocalDefined(std::string_view(id.name))) {
+    if (id.name != NoAtom) {
+        if (scopes.IsLocalDefined(id.name)) {
             // -- name is used in this scope is it a singleton and incomplete class?
-            vec = scopes.CurrentScope()->LocalLookup(std::string_view(id.name));
+            vec = scopes.CurrentScope()->LocalLookup(id.name);
 
             if (vec->size() == 1 && vec->at(0)->kind == Symbol::SymbolKind::IncompleteType) {
                 updateIncomplete = true;
             } else {
-                diags.Error(id.loc, DiagID::DuplicateName, { id.name } );
+                diags.Error(id.loc, DiagID::DuplicateName, { atoms.Spelling(id.name) } );
             }
         }
         scopes.Declare(std::make_unique<RealTypeSymbol>(id.name, id.loc, scopes.CurrentScope()));
@@ -66,8 +66,8 @@ bool Parser::ParseFixedPointConstraint(Id &id)
     //
     // -- The parse is good here
     //    ----------------------
-    if (updateIncomplete) vec->at(0)->kind = Symbol::SymbolKind::Deleted;
-    s.Commit();
+    if (updateIncomplete) scopes.Retire(vec->at(0));
+    m.Commit();
     return true;
 }
 
@@ -24,8 +24,8 @@
 //    -----------------------------------
 bool Parser::ParseFloatingAccuracyDefinition(void)
 {
-    Production p(*this, "floating_accuracy_definition");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::FloatingAccuracyDefinition);
+    MarkStream m(journal);
 
 
     //
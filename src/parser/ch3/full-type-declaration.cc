@@ -24,9 +24,8 @@
 //    -----------------------------
 bool Parser::ParseFullTypeDeclaration(void)
 {
-    Production p(*this, "full_type_definition");
-    MarkStream m(tokens, diags);
-    MarkSymbols s(scopes);
+    Production p(*this, ProdID::FullTypeDefinition);
+    MarkStream m(journal);
     Id id;
 
 
@@ -72,7 +71,6 @@ bool Parser::ParseFullTypeDeclaration(void)
     //
     // -- Consider this parse to be good
     //    ------------------------------
-    s.Commit();
     m.Commit();
     return true;
 }
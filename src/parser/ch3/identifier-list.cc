@@ -24,10 +24,12 @@
 //    ------------------------
 bool Parser::ParseIdentifierList(IdList *ids)
 {
-    Production p(*this, "identifier_list");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::IdentifierList);
+    MarkStream m(journal);
     Id id;
 
+    p.Keep();       // -- a list of one is still a list
+
 
     //
     // -- start by clearing the list -- it should be empty but just in case
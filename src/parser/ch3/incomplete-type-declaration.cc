@@ -24,9 +24,8 @@
 //    ------------------------------------
 bool Parser::ParseIncompleteTypeDeclaration(void)
 {
-    Production p(*this, "incomplete_type_declaration");
-    MarkStream m(tokens, diags);
-    MarkSymbols s(scopes);
+    Production p(*this, ProdID::IncompleteTypeDeclaration);
+    MarkStream m(journal);
     Id id;
     SourceLoc_t loc;
     std::string where = "incomplete type identifier";
@@ -45,9 +44,9 @@ bool Parser::ParseIncompleteTypeDeclaration(void)
     if (!RequireIdent(id)) return false;
 
     if (scopes.IsLocalDefined(id.name)) {
-        diags.Error(loc, DiagID::DuplicateName, { id.name } );
+        diags.Error(loc, DiagID::DuplicateName, { atoms.Spelling(id.name) } );
 
-        const std::vector<Symbol *> *vec = scopes.Lookup(std::string_view(id.name));
+        const std::vector<Symbol *> *vec = scopes.Lookup(id.name);
         SourceLoc_t loc2 = vec->at(0)->loc;
         diags.Error(loc, DiagID::DuplicateName2, { } );
     } else {
@@ -74,7 +73,6 @@ bool Parser::ParseIncompleteTypeDeclaration(void)
     //
     // -- Consider this parse to be good
     //    ------------------------------
-    s.Commit();
     m.Commit();
     return true;
 }
@@ -24,8 +24,8 @@
 //    -------------------------
 bool Parser::ParseIndexConstraint(void)
 {
-    Production p(*this, "index_constraint");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::IndexConstraint);
+    MarkStream m(journal);
     SourceLoc_t loc;
 
 
@@ -24,8 +24,8 @@
 //    ---------------------------------
 bool Parser::ParseIndexSubtypeDefinition(void)
 {
-    Production p(*this, "index_subtype_definition");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::IndexSubtypeDefinition);
+    MarkStream m(journal);
 
 
     //
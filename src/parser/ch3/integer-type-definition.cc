@@ -24,8 +24,8 @@
 //    --------------------------------
 bool Parser::ParseIntegerTypeDefinition(Id &id)
 {
-    Production p(*this, "integer_type_definition");
-    MarkScope s(scopes);
+    Production p(*this, ProdID::IntegerTypeDefinition);
+    MarkStream m(journal);
     std::vector<Symbol *> *vec;
     bool updateIncomplete = false;
 
@@ -34,21 +34,21 @@ bool Parser::ParseIntegerTypeDefinition(Id &id)
     // -- Manage the symbol table
     //    -----------------------
     if (ParseRangeConstraint()) {
-        if (scopes.IsLocalDefined(std::string_view(id.name))) {
+        if (scopes.IsLocalDefined(id.name)) {
             // -- name is used in this scope is it a singleton and incomplete class?
-            vec = scopes.CurrentScope()->LocalLookup(std::string_view(id.name));
+            vec = scopes.CurrentScope()->LocalLookup(id.name);
 
             if (vec->size() == 1 && vec->at(0)->kind == Symbol::SymbolKind::IncompleteType) {
                 updateIncomplete = true;
             } else {
-                diags.Error(id.loc, DiagID::DuplicateName, { id.name } );
+                diags.Error(id.loc, DiagID::DuplicateName, { atoms.Spelling(id.name) } );
             }
         }
 
         scopes.Declare(std::make_unique<IntegerTypeSymbol>(id.name, id.loc, scopes.CurrentScope()));
 
-        if (updateIncomplete) vec->at(0)->kind = Symbol::SymbolKind::Deleted;
-        s.Commit();
+        if (updateIncomplete) scopes.Retire(vec->at(0));
+        m.Commit();
         return true;
     }
 
@@ -30,7 +30,7 @@
 //    ------------------------------
 bool Parser::ParseLaterDeclarativeItem(void)
 {
-    Production p(*this, "later_declarative_item");
+    Production p(*this, ProdID::LaterDeclarativeItem);
 
     if (ParseBody())                        return true;
     if (ParseSubprogramDeclaration())       return true;
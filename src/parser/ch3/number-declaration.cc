@@ -24,9 +24,8 @@
 //    --------------------------
 bool Parser::ParseNumberDeclaration(void)
 {
-    Production p(*this, "number_declaration");
-    MarkStream m(tokens, diags);
-    MarkSymbols s(scopes);
+    Production p(*this, ProdID::NumberDeclaration);
+    MarkStream m(journal);
     std::unique_ptr<IdList> idList = std::make_unique<IdList>();
     SourceLoc_t loc;
 
@@ -42,9 +41,9 @@ bool Parser::ParseNumberDeclaration(void)
     //    ----------------------------------------------------------------
     for (int i = 0; i < idList->size(); i ++) {
         if (scopes.IsLocalDefined(idList->at(i).name)) {
-            diags.Error(idList->at(i).loc, DiagID::DuplicateName, { idList->at(i).name } );
+            diags.Error(idList->at(i).loc, DiagID::DuplicateName, { atoms.Spelling(idList->at(i).name) } );
 
-            const std::vector<Symbol *> *vec = scopes.Lookup(std::string_view(idList->at(i).name));
+            const std::vector<Symbol *> *vec = scopes.Lookup(idList->at(i).name);
             SourceLoc_t loc2 = vec->at(0)->loc;
             diags.Error(loc, DiagID::DuplicateName2, { } );
         } else {
@@ -83,7 +82,6 @@ bool Parser::ParseNumberDeclaration(void)
     //
     // -- Consider this parse to be good
     //    ------------------------------
-    s.Commit();
     m.Commit();
     return true;
 }
@@ -25,9 +25,8 @@
 //    ---------------------------
 bool Parser::ParseObjectDeclaration(void)
 {
-    Production p(*this, "object_declaration");
-    MarkStream m(tokens, diags);
-    MarkSymbols s(scopes);
+    Production p(*this, ProdID::ObjectDeclaration);
+    MarkStream m(journal);
     std::unique_ptr<IdList> idList = std::make_unique<IdList>();
     bool isConstant = false;
     std::string where;
@@ -38,7 +37,7 @@ bool Parser::ParseObjectDeclaration(void)
     //    -----------------------
     if (!ParseIdentifierList(idList.get())) return false;
     if (!Require(TokenType::TOK_COLON)) return false;
-    isConstant = Optional(TokenType::TOK_CONSTANT);
+    isConstant = OptionalLeaf(TokenType::TOK_CONSTANT);
 
 
     //
@@ -46,9 +45,9 @@ bool Parser::ParseObjectDeclaration(void)
     //    ----------------------------------------------------------------
     for (int i = 0; i < idList->size(); i ++) {
         if (scopes.IsLocalDefined(idList->at(i).name)) {
-            diags.Error(idList->at(i).loc, DiagID::DuplicateName, { idList->at(i).name } );
+            diags.Error(idList->at(i).loc, DiagID::DuplicateName, { atoms.Spelling(idList->at(i).name) } );
 
-            const std::vector<Symbol *> *vec = scopes.Lookup(std::string_view(idList->at(i).name));
+            const std::vector<Symbol *> *vec = scopes.Lookup(idList->at(i).name);
             SourceLoc_t loc2 = vec->at(0)->loc;
             diags.Error(loc, DiagID::DuplicateName2, { } );
         } else {
@@ -98,7 +97,6 @@ bool Parser::ParseObjectDeclaration(void)
     //
     // -- Consider this parse to be good
     //    ------------------------------
-    s.Commit();
     m.Commit();
     return true;
 }
@@ -24,7 +24,7 @@
 //    -------------------
 bool Parser::ParseProperBody(void)
 {
-    Production p(*this, "proper_body");
+    Production p(*this, ProdID::ProperBody);
 
     if (ParseSubprogramBody())      return true;
     if (ParsePackageBody())         return true;
@@ -24,8 +24,8 @@
 //    ------------------------
 bool Parser::ParseRangeConstraint(void)
 {
-    Production p(*this, "range_constraint");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::RangeConstraint);
+    MarkStream m(journal);
 
 
     //
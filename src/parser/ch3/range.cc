@@ -23,10 +23,10 @@
 //
 // -- Parse a Range
 //    -------------
-bool Parser::ParseRange(void)
+bool Parser::ParseRange_Body(void)
 {
-    Production p(*this, "range");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::Range);
+    MarkStream m(journal);
 
 
     //
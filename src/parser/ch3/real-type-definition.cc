@@ -24,7 +24,7 @@
 //    ----------------------------
 bool Parser::ParseRealTypeDefinition(Id &id)
 {
-    Production p(*this, "real_type_definition");
+    Production p(*this, ProdID::RealTypeDefinition);
 
     if (ParseFloatingPointConstraint(id))   return true;
     if (ParseFixedPointConstraint(id))      return true;
@@ -24,9 +24,8 @@
 //    ------------------------------
 bool Parser::ParseRecordTypeDefinition(Id &id)
 {
-    Production p(*this, "record_type_definition");
-    MarkStream m(tokens, diags);
-    MarkScope s(scopes);
+    Production p(*this, ProdID::RecordTypeDefinition);
+    MarkStream m(journal);
     SourceLoc_t loc;
     std::vector<Symbol *> *vec;
     bool updateIncomplete = false;
@@ -46,19 +45,19 @@ bool Parser::ParseRecordTypeDefinition(Id &id)
     std::unique_ptr<RecordTypeSymbol> recSym = std::make_unique<RecordTypeSymbol>(id.name, id.loc, scopes.CurrentScope());
     RecordTypeSymbol *rec = recSym.get();
 
-    if (scopes.IsLocalDefined(std::string_view(id.name))) {
+    if (scopes.IsLocalDefined(id.name)) {
         // -- name is used in this scope is it a singleton and incomplete class?
-        vec = scopes.CurrentScope()->LocalLookup(std::string_view(id.name));
+        vec = scopes.CurrentScope()->LocalLookup(id.name);
 
         if (vec->size() == 1 && vec->at(0)->kind == Symbol::SymbolKind::IncompleteType) {
             updateIncomplete = true;
         } else {
-            diags.Error(id.loc, DiagID::DuplicateName, { id.name } );
+            diags.Error(id.loc, DiagID::DuplicateName, { atoms.Spelling(id.name) } );
         }
     }
 
     scopes.Declare(std::move(recSym));
-    scopes.PushScope(Scope::ScopeKind::Record, id.name);
+    scopes.PushScope(Scope::ScopeKind::Record, atoms.Spelling(id.name));
 
 
     //
@@ -88,8 +87,7 @@ bool Parser::ParseRecordTypeDefinition(Id &id)
     //
     // -- Consider this parse to be good
     //    ------------------------------
-    if (updateIncomplete) vec->at(0)->kind = Symbol::SymbolKind::Deleted;
-    s.Commit();
+    if (updateIncomplete) scopes.Retire(vec->at(0));
     m.Commit();
     scopes.PopScope();
     return true;
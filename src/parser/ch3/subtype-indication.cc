@@ -22,11 +22,12 @@
 //
 // -- Parse a Subtype Indication
 //    --------------------------
-bool Parser::ParseSubtypeIndication(void)
+bool Parser::ParseSubtypeIndication_Body(void)
 {
-    Production p(*this, "subtype_indication");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::SubtypeIndication);
+    MarkStream m(journal);
 
+    p.Keep();       // -- a type mark alone is still a subtype indication
 
     //
     // -- Find a type mark and then optionally a constraint
@@ -24,9 +24,8 @@
 //    ---------------------------
 bool Parser::ParseSubtypeDeclaration(void)
 {
-    Production p(*this, "subtype_declaration");
-    MarkStream m(tokens, diags);
-    MarkSymbols s(scopes);
+    Production p(*this, ProdID::SubtypeDeclaration);
+    MarkStream m(journal);
     Id id;
     SourceLoc_t loc;
 
@@ -44,9 +43,9 @@ bool Parser::ParseSubtypeDeclaration(void)
     if (!RequireIdent(id)) return false;
 
     if (scopes.IsLocalDefined(id.name)) {
-        diags.Error(loc, DiagID::DuplicateName, { id.name } );
+        diags.Error(loc, DiagID::DuplicateName, { atoms.Spelling(id.name) } );
 
-        const std::vector<Symbol *> *vec = scopes.Lookup(std::string_view(id.name));
+        const std::vector<Symbol *> *vec = scopes.Lookup(id.name);
         SourceLoc_t loc2 = vec->at(0)->loc;
         diags.Error(loc, DiagID::DuplicateName2, { } );
     } else {
@@ -76,7 +75,6 @@ bool Parser::ParseSubtypeDeclaration(void)
     //
     // -- Consider this parse to be good
     //    ------------------------------
-    s.Commit();
     m.Commit();
     return true;
 }
@@ -26,7 +26,7 @@
 //    ------------------------
 bool Parser::ParseTypeDeclaration(void)
 {
-    Production p(*this, "type_declaration");
+    Production p(*this, ProdID::TypeDeclaration);
 
     if (ParseFullTypeDeclaration())         return true;
     if (ParseIncompleteTypeDeclaration())   return true;
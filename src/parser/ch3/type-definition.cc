@@ -30,15 +30,17 @@
 //    ------------------------
 bool Parser::ParseTypeDefinition(Id &id)
 {
-    Production p(*this, "type_definition");
-
-    if (ParseEnumerationTypeDefinition(id)) return true;
-    if (ParseIntegerTypeDefinition(id))     return true;
-    if (ParseRealTypeDefinition(id))        return true;
-    if (ParseArrayTypeDefinition(id))       return true;
-    if (ParseRecordTypeDefinition(id))      return true;
-    if (ParseAccessTypeDefinition(id))      return true;
-    if (ParseDerivedTypeDefinition(id))     return true;
+    Production p(*this, ProdID::TypeDefinition);
+    TokenType tok = tokens.Current();
+
+    // -- each of these begins with a token of its own, so at most one is tried
+    if (First(ProdID::EnumerationTypeDefinition, tok))  return ParseEnumerationTypeDefinition(id);
+    if (First(ProdID::IntegerTypeDefinition, tok))      return ParseIntegerTypeDefinition(id);
+    if (First(ProdID::RealTypeDefinition, tok))         return ParseRealTypeDefinition(id);
+    if (First(ProdID::ArrayTypeDefinition, tok))        return ParseArrayTypeDefinition(id);
+    if (First(ProdID::RecordTypeDefinition, tok))       return ParseRecordTypeDefinition(id);
+    if (First(ProdID::AccessTypeDefinition, tok))       return ParseAccessTypeDefinition(id);
+    if (First(ProdID::DerivedTypeDefinition, tok))      return ParseDerivedTypeDefinition(id);
     return false;
 }
 
@@ -23,7 +23,7 @@
 //    -----------------
 bool Parser::ParseTypeMark(void)
 {
-    Production p(*this, "type_mark");
+    Production p(*this, ProdID::TypeMark);
 
     if (ParseTypeName())        return true;
     if (ParseSubtypeName())     return true;
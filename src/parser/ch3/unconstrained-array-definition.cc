@@ -25,9 +25,8 @@
 //    ---------------------------------------
 bool Parser::ParseUnconstrainedArrayDefinition(Id &id)
 {
-    Production p(*this, "unconstrained_array_definition");
-    MarkStream m(tokens, diags);
-    MarkScope s(scopes);
+    Production p(*this, ProdID::UnconstrainedArrayDefinition);
+    MarkStream m(journal);
     SourceLoc_t loc;
     std::vector<Symbol *> *vec;
     bool updateIncomplete = false;
@@ -44,13 +43,13 @@ bool Parser::ParseUnconstrainedArrayDefinition(Id &id)
     //
     // -- Manage the symbol table
     //    -----------------------
-    if (scopes.IsLocalDefined(std::string_view(id.name))) {
+    if (scopes.IsLocalDefined(id.name)) {
         // -- name is used in this scope is it a singleton and incomplete class?
-        vec = scopes.CurrentScope()->LocalLookup(std::string_view(id.name));
+        vec = scopes.CurrentScope()->LocalLookup(id.name);
         if (vec->size() == 1 && vec->at(0)->kind == Symbol::SymbolKind::IncompleteType) {
             updateIncomplete = true;
         } else {
-            diags.Error(id.loc, DiagID::DuplicateName, { id.name } );
+            diags.Error(id.loc, DiagID::DuplicateName, { atoms.Spelling(id.name) } );
         }
     }
 
@@ -103,9 +102,8 @@ bool Parser::ParseUnconstrainedArrayDefinition(Id &id)
     //
     // -- Consider this parse to be good
     //    ------------------------------
-    if (updateIncomplete) vec->at(0)->kind = Symbol::SymbolKind::Deleted;
+    if (updateIncomplete) scopes.Retire(vec->at(0));
 
-    s.Commit();
     m.Commit();
     return true;
 }
@@ -24,8 +24,8 @@
 //    --------------------
 bool Parser::ParseVariantPart(RecordTypeSymbol *rec)
 {
-    Production p(*this, "variant_part");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::VariantPart);
+    MarkStream m(journal);
     Id id;
     SourceLoc_t loc;
 
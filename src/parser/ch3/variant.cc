@@ -24,8 +24,8 @@
 //    ---------------
 bool Parser::ParseVariant(RecordTypeSymbol *rec)
 {
-    Production p(*this, "variant");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::Variant);
+    MarkStream m(journal);
     SourceLoc_t loc;
 
 
@@ -5,6 +5,12 @@
 //
 //  aggregate ::= ( component_association {, component_association} )
 //
+//  A parenthesized expression `( expression )` is parsed here as well, since it cannot be told from an
+//  aggregate of one positional association until the `)`.  Ada requires an aggregate of one component
+//  to be named, so a lone positional association is the expression, and is passed on without an
+//  aggregate around it.
+//
+//
 // ---------------------------------------------------------------------------------------------------------------
 //
 //     Date      Tracker  Version  Pgmr  Description
@@ -22,15 +28,24 @@
 //
 // -- Parse an Aggregate
 //    ------------------
-bool Parser::ParseAggregate(void)
+bool Parser::ParseAggregate_Body(void)
 {
-    Production p(*this, "aggregate");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::Aggregate);
+    MarkStream m(journal);
     SourceLoc_t loc;
 
     if (!Require(TokenType::TOK_LEFT_PARENTHESIS))          return false;
     if (!ParseComponentAssociation())                       return false;
 
+    const ASTNode_t &assoc = ast.Node(ast.Last());
+    bool named = (assoc.kind == NodeKind::Production && assoc.prod == ProdID::ComponentAssociation);
+
+    if (!named && Optional(TokenType::TOK_RIGHT_PARENTHESIS)) {
+        p.Pass();       // -- ( expression )
+        m.Commit();
+        return true;
+    }
+
     loc = tokens.SourceLocation();
     while (Optional(TokenType::TOK_COMMA)) {
         if (!ParseComponentAssociation()) {
@@ -58,8 +73,8 @@ bool Parser::ParseAggregate(void)
 //    -------------------------
 bool Parser::ParseAggregateMore(void)
 {
-    Production p(*this, "aggregate(more)");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::AggregateMore);
+    MarkStream m(journal);
     SourceLoc_t loc;
 
     loc = tokens.SourceLocation();
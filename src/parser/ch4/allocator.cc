@@ -25,8 +25,8 @@
 //    ------------------
 bool Parser::ParseAllocator(void)
 {
-    Production p(*this, "allocator");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::Allocator);
+    MarkStream m(journal);
 
     if (!Require(TokenType::TOK_NEW)) return false;
 
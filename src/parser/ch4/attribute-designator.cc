@@ -24,8 +24,8 @@
 //    -----------------------------
 bool Parser::ParseAttributeDesignator(void)
 {
-    Production p(*this, "attribute_designator");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::AttributeDesignator);
+    MarkStream m(journal);
     Id id;
     SourceLoc_t loc = tokens.SourceLocation();
 
@@ -33,12 +33,12 @@ bool Parser::ParseAttributeDesignator(void)
     //
     // -- handle 3 special cases where the attribute name is not just an ID, but also a token
     //    -----------------------------------------------------------------------------------
-    if (Optional(TokenType::TOK_DIGITS)) {
-        id = { "digits", loc };
-    } else if (Optional(TokenType::TOK_DELTA)) {
-        id = { "delta", loc };
-    } else if (Optional(TokenType::TOK_RANGE)) {
-        id = { "range", loc };
+    if (OptionalLeaf(TokenType::TOK_DIGITS)) {
+        id = { atoms.Intern("digits"), loc };
+    } else if (OptionalLeaf(TokenType::TOK_DELTA)) {
+        id = { atoms.Intern("delta"), loc };
+    } else if (OptionalLeaf(TokenType::TOK_RANGE)) {
+        id = { atoms.Intern("range"), loc };
     } else if (!ParseSimpleName(id))           return false;
 
     if (Optional(TokenType::TOK_LEFT_PARENTHESIS)) {
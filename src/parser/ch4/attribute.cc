@@ -24,8 +24,8 @@
 //    ------------------
 bool Parser::ParseAttribute(void)
 {
-    Production p(*this, "attribute");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::Attribute);
+    MarkStream m(journal);
 
     if (!ParsePrefix())                             return false;
     if (!Require(TokenType::TOK_APOSTROPHE))        return false;
@@ -44,8 +44,8 @@ bool Parser::ParseAttribute(void)
 //    ------------------------------------------------------
 bool Parser::ParseName_AttributeSuffix(void)
 {
-    Production p(*this, "name(attribute)");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::NameAttribute);
+    MarkStream m(journal);
 
     if (!Require(TokenType::TOK_APOSTROPHE))        return false;
     if (!ParseAttributeDesignator())                return false;
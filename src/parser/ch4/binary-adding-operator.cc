@@ -24,8 +24,8 @@
 //    ------------------------------
 bool Parser::ParseBinaryAddingOperator(void)
 {
-    Production p(*this, "binary_adding_operator");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::BinaryAddingOperator);
+    MarkStream m(journal);
 
     switch (tokens.Current()) {
     case TokenType::TOK_PLUS:
@@ -12,10 +12,11 @@
 //           | others                   trivial
 //           | component_simple_name    expression
 //
-//  For this production (component_association) to work, the production choice will need to be folded into this
-//  function.  This will allow the correct amount of lookahead to cleanly parse this production.  The good news
-//  here is that component_association is only referenced from aggregate and as such the only 2 delimiting
-//  tokens for a component_association are TOK_COMMA and TOK_RIGHT_PARENTHESIS.
+//  So `choice` is folded into this function.  The first choice is parsed once, as a discrete range or a
+//  simple expression, and the token after it decides the rest: a `|` or `=>` makes it a named association,
+//  and anything else makes the simple expression the start of a positional one.  A component simple name
+//  is a simple expression until then.  Nothing is parsed twice, however deeply aggregates nest.
+//
 //
 // ---------------------------------------------------------------------------------------------------------------
 //
@@ -34,27 +35,34 @@
 //
 // -- Parse a Component Association
 //    -----------------------------
-bool Parser::ParseComponentAssociation(void)
+bool Parser::ParseComponentAssociation_Body(void)
 {
-    Production p(*this, "component_association");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::ComponentAssociation);
+    MarkStream m(journal);
     SourceLoc_t loc;
+    bool range = false;
+
 
+    if (!OptionalLeaf(TokenType::TOK_OTHERS)) {
+        if (!ParseDiscreteRange_OrSimpleExpression(range, true)) return false;
 
-    if (ParseChoice()) {
-        while (Optional(TokenType::TOK_VERTICAL_BAR)) {
-            loc = tokens.SourceLocation();
-            if (!ParseChoice()) {
-                diags.Error(loc, DiagID::ExtraVertialBar, { "component association" } );
-            }
+        if (!range && tokens.Current() != TokenType::TOK_VERTICAL_BAR && tokens.Current() != TokenType::TOK_ARROW) {
+            if (!ParseExpression_Operators(ExprLevel::Logical, true)) return false;
+
+            m.Commit();
+            return true;
         }
+    }
 
-        if (!Require(TokenType::TOK_ARROW)) {
-            m.Reset();      // -- may only be a simple expression, which cannot be a choice here
+    while (Optional(TokenType::TOK_VERTICAL_BAR)) {
+        loc = tokens.SourceLocation();
+        if (!OptionalLeaf(TokenType::TOK_OTHERS) && !ParseDiscreteRange_OrSimpleExpression(range, true)) {
+            diags.Error(loc, DiagID::ExtraVertialBar, { "component association" } );
         }
     }
 
-    if (!ParseExpression()) return false;
+    if (!Require(TokenType::TOK_ARROW))     return false;
+    if (!ParseExpression())                 return false;
 
 
     m.Commit();
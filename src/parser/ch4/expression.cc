@@ -9,6 +9,23 @@
 //               | relation [or else relation]
 //               | relation [xor relation]
 //
+//  The layers below an expression (`relation`, `simple_expression`, `term` and `factor`) are each one
+//  precedence level, so they are all parsed by one precedence-climbing loop here rather than one
+//  production each.  An operand costs only its `primary`.  The loop still holds to the Ada rules which
+//  the layered grammar spells out:
+//
+//  * the logical operators in an expression must all be the same; a different one ends the expression
+//  * a relation has at most one relational operator or membership test
+//  * a unary adding operator may only begin a simple expression
+//  * `**` is not associative; a second one ends the factor
+//
+//  In each case the operator which breaks the rule is left in the stream, as the layered productions
+//  left it, for the caller to report.
+//
+//  The loop builds the operators into the tree as it goes: each operator takes the operand built so far
+//  and the one after it, so the operators of one level group to the left.  A leading unary adding
+//  operator is applied to the whole first term once it is complete.
+//
 // ---------------------------------------------------------------------------------------------------------------
 //
 //     Date      Tracker  Version  Pgmr  Description
@@ -26,39 +43,162 @@
 //
 // -- Parse an Expression
 //    -------------------
-bool Parser::ParseExpression(void)
+bool Parser::ParseExpression_Body(void)
 {
-    Production p(*this, "expression");
-    MarkStream m(tokens, diags);
-    TokenType tok;
+    Production p(*this, ProdID::Expression);
+    MarkStream m(journal);
+
+    if (!ParseExpression_Operators(ExprLevel::Logical)) return false;
+
+    m.Commit();
+    return true;
+}
 
 
-    if (!ParseRelation()) return false;
 
-    switch (tokens.Current()) {
+//
+// -- The level of a binary operator; `not in` is found by the caller
+//    ---------------------------------------------------------------
+static ExprLevel OperatorLevel(TokenType tok)
+{
+    switch (tok) {
     case TokenType::TOK_AND:
     case TokenType::TOK_AND_THEN:
     case TokenType::TOK_OR:
     case TokenType::TOK_OR_ELSE:
     case TokenType::TOK_XOR:
-        tok = tokens.Current();
-        break;
+        return ExprLevel::Logical;
+
+    case TokenType::TOK_EQUAL:
+    case TokenType::TOK_INEQUALITY:
+    case TokenType::TOK_LESS_THAN:
+    case TokenType::TOK_LESS_THAN_OR_EQUAL:
+    case TokenType::TOK_GREATER_THAN:
+    case TokenType::TOK_GREATER_THAN_OR_EQUAL:
+    case TokenType::TOK_IN:
+        return ExprLevel::Relational;
+
+    case TokenType::TOK_PLUS:
+    case TokenType::TOK_MINUS:
+    case TokenType::TOK_AMPERSAND:
+        return ExprLevel::Adding;
+
+    case TokenType::TOK_STAR:
+    case TokenType::TOK_SLASH:
+    case TokenType::TOK_MOD:
+    case TokenType::TOK_REM:
+        return ExprLevel::Multiplying;
 
     default:
-        m.Commit();
-        return true;
+        return ExprLevel::None;
+    }
+}
+
+
+
+//
+// -- Parse the operators and operands of an expression which bind at least as tightly as `min`, so
+//    that `Logical` is a whole expression, `Relational` a relation, `Adding` a simple expression and
+//    `Multiplying` a term.  The right operand of an operator is parsed at the next level up.
+//
+//    When `continued`, a whole simple expression has already been parsed and is the last subtree
+//    pending; the expression goes on from there.  This lets a caller which had to parse a simple
+//    expression to find out what it was in (a range, say) keep it when it was an expression after all.
+//
+//    There is no mark here: a failure anywhere fails the whole, and the caller resets.
+//    ----------------------------------------------------------------------------------------------
+bool Parser::ParseExpression_Operators(ExprLevel min, bool continued)
+{
+    TokenType logical = TokenType::YYEOF;       // -- the logical operator of this expression, once seen
+    bool related = false;                       // -- the current relation has its relational operator
+    TokenType unary = TokenType::YYEOF;         // -- the unary adding operator not yet applied
+    SourceLoc_t unaryLoc;
+    size_t first = ast.Pending();               // -- where the operand built so far is pending
+    int start = tokens.Location();
+
+    if (continued) {
+        first --;
+        start = ast.From(first);
     }
 
-    while (Optional(tok)) {
-        if (!ParseRelation()) {
-            // -- TODO: maybe issue an error about missing a relation and return true instead???
-            return false;
+    auto Apply = [&](void) {
+        if (unary == TokenType::YYEOF) return;
+        ast.Reduce(NodeKind::Unary, unary, unaryLoc, first, start, tokens.Location());
+        unary = TokenType::YYEOF;
+    };
+
+    if (!continued && min <= ExprLevel::Adding) {
+        if (tokens.Current() == TokenType::TOK_PLUS || tokens.Current() == TokenType::TOK_MINUS) {
+            unary = tokens.Current();
+            unaryLoc = tokens.SourceLocation();
+            tokens.Advance();
         }
     }
 
-    m.Commit();
-    return true;
-}
+    if (!continued && !ParseFactor_Operand()) return false;
+
+    while (true) {
+        TokenType tok = tokens.Current();
+        bool notIn = (tok == TokenType::TOK_NOT && tokens.Peek() == TokenType::TOK_IN);
+        ExprLevel level = notIn ? ExprLevel::Relational : OperatorLevel(tok);
+        SourceLoc_t loc = tokens.SourceLocation();
+
+        if (level == ExprLevel::None || level < min) { Apply(); return true; }
+
+        // -- once a relation is complete, only a logical operator can follow it
+        if (related && level != ExprLevel::Logical) { Apply(); return true; }
+
+        // -- the first term is complete once an operator looser than a multiplying one is found
+        if (level < ExprLevel::Multiplying) Apply();
+
+        switch (level) {
+        case ExprLevel::Logical:
+            if (logical != TokenType::YYEOF && tok != logical) return true;
+            logical = tok;
+            tokens.Advance();
+
+            if (!ParseExpression_Operators(ExprLevel::Relational)) return false;
+
+            ast.Reduce(NodeKind::Binary, tok, loc, first, start, tokens.Location());
+            related = true;
+            break;
+
+        case ExprLevel::Relational:
+            related = true;
 
+            if (notIn || tok == TokenType::TOK_IN) {
+                if (notIn) tokens.Advance();
+                tokens.Advance();
 
+                if (!ParseRange() && !ParseTypeMark()) return false;
+
+                ast.Reduce(NodeKind::Membership, tok, loc, first, start, tokens.Location());
+                break;
+            }
+
+            tokens.Advance();
+            if (!ParseExpression_Operators(ExprLevel::Adding)) return false;
+
+            ast.Reduce(NodeKind::Binary, tok, loc, first, start, tokens.Location());
+            break;
+
+        case ExprLevel::Adding:
+            tokens.Advance();
+            if (!ParseExpression_Operators(ExprLevel::Multiplying)) return false;
+
+            ast.Reduce(NodeKind::Binary, tok, loc, first, start, tokens.Location());
+            break;
+
+        case ExprLevel::Multiplying:
+            tokens.Advance();
+            if (!ParseFactor_Operand()) return false;
+
+            ast.Reduce(NodeKind::Binary, tok, loc, first, start, tokens.Location());
+            break;
+
+        default:
+            return true;
+        }
+    }
+}
 
@@ -24,11 +24,29 @@
 //
 // -- Parse a Factor
 //    --------------
-bool Parser::ParseFactor(void)
+bool Parser::ParseFactor_Body(void)
 {
-    Production p(*this, "factor");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::Factor);
+    MarkStream m(journal);
+
+    if (!ParseFactor_Operand()) return false;
+
+    m.Commit();
+    return true;
+}
+
+
+
+//
+// -- Parse a factor as an operand of the expression loop, without a production or a mark of its
+//    own; the caller resets if it fails
+//    ------------------------------------------------------------------------------------------
+bool Parser::ParseFactor_Operand(void)
+{
+    SourceLoc_t opLoc = tokens.SourceLocation();
     SourceLoc_t loc;
+    size_t first = ast.Pending();
+    int start = tokens.Location();
 
     if (Require(TokenType::TOK_ABS)) {
         loc = tokens.SourceLocation();
@@ -36,7 +54,7 @@ bool Parser::ParseFactor(void)
             diags.Error(loc, DiagID::InvalidPrimaryExpr, { "ABS" } );
         }
 
-        m.Commit();
+        ast.Reduce(NodeKind::Unary, TokenType::TOK_ABS, opLoc, first, start, tokens.Location());
         return true;
     } else if (Require(TokenType::TOK_NOT)) {
         loc = tokens.SourceLocation();
@@ -44,16 +62,18 @@ bool Parser::ParseFactor(void)
             diags.Error(loc, DiagID::InvalidPrimaryExpr, { "NOT" } );
         }
 
-        m.Commit();
+        ast.Reduce(NodeKind::Unary, TokenType::TOK_NOT, opLoc, first, start, tokens.Location());
         return true;
     } else {
         if (!ParsePrimary())    return false;
 
+        opLoc = tokens.SourceLocation();
         if (Optional(TokenType::TOK_DOUBLE_STAR)) {
             if (!ParsePrimary())    return false;
+
+            ast.Reduce(NodeKind::Binary, TokenType::TOK_DOUBLE_STAR, opLoc, first, start, tokens.Location());
         }
 
-        m.Commit();
         return true;
     }
 
@@ -24,8 +24,8 @@
 //    --------------------------
 bool Parser::ParseIndexedComponent(void)
 {
-    Production p(*this, "indexed_component");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::IndexedComponent);
+    MarkStream m(journal);
 
     if (!ParsePrefix())                                 return false;
     if (!Require(TokenType::TOK_LEFT_PARENTHESIS))      return false;
@@ -46,25 +46,3 @@ bool Parser::ParseIndexedComponent(void)
 
 
 
-//
-// -- Parse an Indexed Component for Name
-//
-//    For this function, name has already been accounted for
-//    ------------------------------------------------------
-bool Parser::ParseName_IndexComponentSuffix(void)
-{
-    Production p(*this, "indexed_component(suffix)");
-    MarkStream m(tokens, diags);
-
-    if (!ParseExpression())                     return false;
-
-    while (Optional(TokenType::TOK_COMMA)) {
-        if (!ParseExpression())                 return false;
-    }
-
-    m.Commit();
-    return true;
-}
-
-
-
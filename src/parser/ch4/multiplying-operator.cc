@@ -24,8 +24,8 @@
 //    ----------------------------
 bool Parser::ParseMultiplyingOperator(void)
 {
-    Production p(*this, "multiplying_operator");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::MultiplyingOperator);
+    MarkStream m(journal);
 
     switch (tokens.Current()) {
     case TokenType::TOK_STAR:
@@ -35,10 +35,10 @@
 bool Parser::ParseNameNonExpr(Id &id)
 {
     // -- This top-level production must Mark its location so it can output diags
-    Production p(*this, "name(non-expr)");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::NameNonExpr);
+    MarkStream m(journal);
 
-    if (Optional(TokenType::TOK_CHARACTER_LITERAL)) {
+    if (OptionalLeaf(TokenType::TOK_CHARACTER_LITERAL)) {
         m.Commit();
         return true;
     }
@@ -68,13 +68,15 @@ bool Parser::ParseNameNonExpr(Id &id)
 bool Parser::ParseNameExpr(Id &id)
 {
     // -- This top-level production must Mark its location so it can output diags
-    Production p(*this, "name(expr)");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::NameExpr);
+    MarkStream m(journal);
+    size_t first = ast.Pending();
 
     if (!ParseName_Base(id))        return false;
 
     while (ParseName_Postfix()) {
-        // -- Do something important here
+        // -- the name so far is the prefix of the suffix just parsed
+        ast.Graft(first);
     }
 
     m.Commit();
@@ -91,10 +93,10 @@ bool Parser::ParseNameExpr(Id &id)
 //    -----------------------------------------------------------------
 bool Parser::ParseName_Base(Id &id)
 {
-    Production p(*this, "name(base)");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::NameBase);
+    MarkStream m(journal);
 
-    if (Optional(TokenType::TOK_CHARACTER_LITERAL)) {
+    if (OptionalLeaf(TokenType::TOK_CHARACTER_LITERAL)) {
         m.Commit();
         return true;
     }
@@ -116,8 +118,10 @@ bool Parser::ParseName_Base(Id &id)
 //    ----------------------------------------------------------------
 bool Parser::ParseName_Postfix(void)
 {
-    Production p(*this, "name(postfix)");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::NamePostfix);
+    MarkStream m(journal);
+
+    p.Lift();       // -- the suffix alone is passed on, without the parentheses around it
 
     if (Optional(TokenType::TOK_LEFT_PARENTHESIS)) {
         if (ParseName_IndexOrSliceSuffix()) {
@@ -140,36 +144,38 @@ bool Parser::ParseName_Postfix(void)
 
 
 //
-// -- Parse either a Indexed or Selected component
-//    --------------------------------------------
+// -- Parse either an Indexed Component or a Slice suffix
+//
+//    The first part inside the parentheses is parsed once, as a discrete range or a simple
+//    expression; what follows it decides which suffix this is.  A simple expression goes on as the
+//    first index, so nothing is parsed twice however deeply the names nest.
+//    ----------------------------------------------------------------------------------------------
 bool Parser::ParseName_IndexOrSliceSuffix(void)
 {
-    Production p(*this, "name(index_or_selected_component)");
-    MarkStream m(tokens, diags);
-
-    m.Reset();
-    if (ParseName_SliceSuffix()) {
-        // -- do something important here
-        m.Commit();
-        return true;
-    }
+    Production p(*this, ProdID::NameIndexOrSelectedComponent);
+    MarkStream m(journal);
+    size_t first = ast.Pending();
+    int start = tokens.Location();
+    SourceLoc_t loc = tokens.SourceLocation();
+    bool range;
 
+    if (!ParseDiscreteRange_OrSimpleExpression(range, false)) return false;
 
-    if (ParseName_IndexComponentSuffix()) {
-        // -- do something important here
+    if (range) {
+        ast.Wrap(ProdID::SliceSuffix, loc, first, start, tokens.Location());
         m.Commit();
         return true;
     }
 
+    if (!ParseExpression_Operators(ExprLevel::Logical, true))   return false;
 
-    m.Reset();
-    if (ParseName_SelectedComponentSuffix()) {
-        // -- do something important here
-        m.Commit();
-        return true;
+    while (Optional(TokenType::TOK_COMMA)) {
+        if (!ParseExpression())                                 return false;
     }
 
-    return false;
+    ast.Wrap(ProdID::IndexedComponentSuffix, loc, first, start, tokens.Location());
+    m.Commit();
+    return true;
 }
 
 
@@ -179,16 +185,15 @@ bool Parser::ParseName_IndexOrSliceSuffix(void)
 //    ---------------------------------------------------------
 bool Parser::ParseTypeName(void) {
     Id id;
+    AST::Checkpoint_t chkpt = ast.Checkpoint();
+    int at = tokens.Location();
     if (!ParseNameNonExpr(id)) return false;
-    const std::vector<Symbol *> *vec = scopes.Lookup(id.name);
-    if (vec) {
-        for (int i = 0; i < vec->size(); i ++) {
-            if (vec->at(i)->kind == Symbol::SymbolKind::Type) return true;
-            if (vec->at(i)->kind == Symbol::SymbolKind::IncompleteType) return true;
-        }
-    }
+    NameClass_t cls = Classify(at, id.name);
+    if (cls.type || cls.incomplete) return true;
 
 
+    // -- the name is not a type, so it is not kept in the tree
+    ast.Rollback(chkpt);
     return false;
 }
 
@@ -200,16 +205,13 @@ bool Parser::ParseTypeName(void) {
 //    -----------------------------------------
 bool Parser::ParseSubtypeName(void) {
     Id id;
+    AST::Checkpoint_t chkpt = ast.Checkpoint();
+    int at = tokens.Location();
     if (!ParseNameNonExpr(id)) return false;
-    const std::vector<Symbol *> *vec = scopes.Lookup(id.name);
-    if (!vec || vec->empty()) return false;
-    for (int i = 0; i < vec->size(); i ++) {
-        if (vec->at(i)->kind == Symbol::SymbolKind::Type) {
-            TypeSymbol *tp = static_cast<TypeSymbol *>(vec->at(i));
-            if (tp->category == TypeSymbol::TypeCategory::Subtype) return true;
-        }
-    }
+    if (Classify(at, id.name).subtype) return true;
 
+    // -- the name is not a subtype, so it is not kept in the tree
+    ast.Rollback(chkpt);
     return false;
 }
 
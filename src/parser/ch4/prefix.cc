@@ -25,7 +25,7 @@
 //    --------------
 bool Parser::ParsePrefix(void)
 {
-    Production p(*this, "prefix");
+    Production p(*this, ProdID::Prefix);
     Id discard;
 
     if (ParseNameExpr(discard))     return true;
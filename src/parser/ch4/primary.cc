@@ -35,6 +35,10 @@
 //  Therefore, this production will make extensive use of the `Optional` and `Peek` functions to make some
 //  critical decisions while parsing.
 //
+//  Every nested expression is a primary inside another, so this is also where nesting is limited.  A
+//  primary nested deeper than `--max-nesting` is reported and skipped up to the end of the expression
+//  around it, which keeps the native stack bounded however the source is generated.
+//
 // ---------------------------------------------------------------------------------------------------------------
 //
 //     Date      Tracker  Version  Pgmr  Description
@@ -49,140 +53,144 @@
 
 
 
+//
+// -- Skip the tokens of a primary nested too deeply: up to the `)` which closes the expression around
+//    it, or the end of the statement if the parentheses do not balance
+//    ------------------------------------------------------------------------------------------------
+static void SkipNested(TokenStream &ts)
+{
+    int open = 0;
+
+    while (ts.Current() != TokenType::YYEOF && ts.Current() != TokenType::TOK_SEMICOLON) {
+        if (ts.Current() == TokenType::TOK_LEFT_PARENTHESIS) open ++;
+        else if (ts.Current() == TokenType::TOK_RIGHT_PARENTHESIS && open -- == 0) return;
+
+        ts.Advance();
+    }
+}
+
+
+
 //
 // -- Parse a Primary
 //    ---------------
-bool Parser::ParsePrimary(void)
+bool Parser::ParsePrimary_Body(void)
 {
-    Production p(*this, "primary");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::Primary);
+    MarkStream m(journal);
+    Nesting n(*this);
     Id id;
     SourceLoc_t loc = tokens.SourceLocation();
 
-    if (Optional(TokenType::TOK_NULL)) {
+    if (nesting > opts.maxNesting) {
+        int start = tokens.Location();
+
+        diags.Error(loc, DiagID::NestingTooDeep, { std::to_string(opts.maxNesting) } );
+        SkipNested(tokens);
+        if (tokens.Location() == start) return false;
+
         m.Commit();
         return true;
     }
 
-
+    switch (tokens.Current()) {
     //
     // -- The spec calls for a `numeric_literal` here.  I am going to split them out
     //    here rather than in the lexer.
     //    --------------------------------------------------------------------------
-    if (Optional(TokenType::TOK_UNIVERSAL_INT_LITERAL)) {
+    case TokenType::TOK_NULL:
+    case TokenType::TOK_UNIVERSAL_INT_LITERAL:
+    case TokenType::TOK_UNIVERSAL_REAL_LITERAL:
+    case TokenType::TOK_STRING_LITERAL:
+        Token();
         m.Commit();
         return true;
-    }
-
-    if (Optional(TokenType::TOK_UNIVERSAL_REAL_LITERAL)) {
-        m.Commit();
-        return true;
-    }
 
 
-    if (Optional(TokenType::TOK_STRING_LITERAL)) {
-        m.Commit();
-        return true;
-    }
-
-
-    if (tokens.Current() == TokenType::TOK_NEW) {
+    case TokenType::TOK_NEW:
         if (ParseAllocator()) {
             m.Commit();
             return true;
         }
 
-        m.Reset();
-    }
+        return false;
 
 
-    if (tokens.Current() == TokenType::TOK_CHARACTER_LITERAL) {
+    case TokenType::TOK_CHARACTER_LITERAL:
         if (ParseNameExpr(id)) {
             m.Commit();
             return true;
         }
 
-        m.Reset();
-    }
-
-
-    if (ParseOperatorSymbol()) {
-        m.Commit();
-        return true;
-    }
+        return false;
 
 
     //
     // -- Now, an Identifier can start several different alternatives.  Check here for each.
     //    ----------------------------------------------------------------------------------
-    if (tokens.Current() == TokenType::TOK_IDENTIFIER) {
+    case TokenType::TOK_IDENTIFIER: {
         IdentifierLexeme idLex = std::get<IdentifierLexeme>(tokens.Payload());
-        const std::vector<Symbol *> *vec = scopes.Lookup(idLex.name);
-
-        if (vec != nullptr) {
-            TypeSymbol *type = nullptr;
-
-            for (auto &sym : *vec) {
-                if (sym->kind == Symbol::SymbolKind::Deleted) continue;
-                if (sym->kind == Symbol::SymbolKind::Type || sym->kind == Symbol::SymbolKind::IncompleteType) {
-                    if (tokens.Peek() == TokenType::TOK_APOSTROPHE) {
-                        if (tokens.Peek(2) == TokenType::TOK_DIGITS || tokens.Peek(2) == TokenType::TOK_DELTA) {
-                            if (ParseNameExpr(id)) {
-                                m.Commit();
-                                return true;
-                            }
-                        }
-                        if (ParseQualifiedExpression()) {
-                            m.Commit();
-                            return true;
-                        } else if (ParseNameExpr(id)) {
-                            m.Commit();
-                            return true;
-                        }
-                    }
-                    if (tokens.Peek() == TokenType::TOK_LEFT_PARENTHESIS) {
-                        if (ParseTypeConversion()) {
-                            m.Commit();
-                            return true;
-                        }
-                    }
-                }
-                if (sym->kind == Symbol::SymbolKind::Subprogram) {
-                    if (ParseFunctionCall()) {
+        NameClass_t cls = Classify(tokens.Location(), idLex.name);
+
+        if (!cls.known) return false;
+
+        if (cls.type || cls.incomplete) {
+            if (tokens.Peek() == TokenType::TOK_APOSTROPHE) {
+                if (tokens.Peek(2) == TokenType::TOK_DIGITS || tokens.Peek(2) == TokenType::TOK_DELTA) {
+                    if (ParseNameExpr(id)) {
                         m.Commit();
                         return true;
                     }
                 }
-                if (ParseNameExpr(id)) {
+                if (ParseQualifiedExpression()) {
+                    m.Commit();
+                    return true;
+                } else if (ParseNameExpr(id)) {
                     m.Commit();
                     return true;
                 }
-
-                diags.Error(loc, DiagID::UnknownError, { __FILE__, __PRETTY_FUNCTION__, std::to_string(__LINE__) } );
             }
+            if (tokens.Peek() == TokenType::TOK_LEFT_PARENTHESIS) {
+                if (ParseTypeConversion()) {
+                    m.Commit();
+                    return true;
+                }
+            }
+        }
+        if (cls.subprogram) {
+            if (ParseFunctionCall()) {
+                m.Commit();
+                return true;
+            }
+        }
+        if (ParseNameExpr(id)) {
+            m.Commit();
+            return true;
         }
+
+        diags.Error(loc, DiagID::UnknownError, { __FILE__, __PRETTY_FUNCTION__, std::to_string(__LINE__) } );
+        return false;
     }
 
 
-    //
-    // -- Now, everything else will start with a TOK_LEFT_PAREN
-    //    -----------------------------------------------------
-    if (!Require(TokenType::TOK_LEFT_PARENTHESIS)) return false;
+    case TokenType::TOK_LEFT_PARENTHESIS:
+        break;
 
 
-    //
-    // -- If we have an expression followed by a TOK_RIGHT_PARENTHESIS, then we have a parenthetical expression
-    //    -----------------------------------------------------------------------------------------------------
-    if (ParseExpression()) {
-        if (Require(TokenType::TOK_RIGHT_PARENTHESIS)) {
+    default:
+        if (ParseOperatorSymbol()) {
             m.Commit();
             return true;
         }
+
+        return false;
     }
 
-    // -- we want to reset here and try again with an aggregate -- the only thing left
-    m.Reset();
 
+    //
+    // -- Now, everything else starts with a TOK_LEFT_PAREN: an aggregate, or a parenthesized expression,
+    //    which the aggregate passes on as it is
+    //    -----------------------------------------------------------------------------------------------
     if (ParseAggregate()) {
         m.Commit();
         return true;
@@ -192,3 +200,4 @@ bool Parser::ParsePrimary(void)
 }
 
 
+
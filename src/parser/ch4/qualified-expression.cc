@@ -25,8 +25,8 @@
 //    ----------------------------
 bool Parser::ParseQualifiedExpression(void)
 {
-    Production p(*this, "qualified_expression");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::QualifiedExpression);
+    MarkStream m(journal);
     SourceLoc_t loc;
 
     if (!ParseTypeMark())       return false;
@@ -53,7 +53,6 @@ bool Parser::ParseQualifiedExpression(void)
         return true;
     }
 
-    m.Commit();
     return false;
 }
 
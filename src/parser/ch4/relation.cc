@@ -24,37 +24,12 @@
 //
 // -- Parse a Relation
 //    ----------------
-bool Parser::ParseRelation(void)
+bool Parser::ParseRelation_Body(void)
 {
-    Production p(*this, "relation");
-    MarkStream m(tokens, diags);
-    bool hasNot = false;
-
-    if (!ParseSimpleExpression())  return false;
-
-    if ((tokens.Current() == TokenType::TOK_NOT && tokens.Peek() == TokenType::TOK_IN)
-            || tokens.Current() == TokenType::TOK_IN) {
-        if (Optional(TokenType::TOK_NOT)) hasNot = true;
-        if (!Require(TokenType::TOK_IN))  return false;
-
-        if (ParseRange()) {
-            m.Commit();
-            return true;
-        }
-
-        if (ParseTypeMark()) {
-            m.Commit();
-            return true;
-        }
-
-        return false;
-    }
-
-
-    if (ParseRelationalOperator()) {
-        if (!ParseSimpleExpression()) return false;
-    }
+    Production p(*this, ProdID::Relation);
+    MarkStream m(journal);
 
+    if (!ParseExpression_Operators(ExprLevel::Relational)) return false;
 
     m.Commit();
     return true;
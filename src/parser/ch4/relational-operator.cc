@@ -24,8 +24,8 @@
 //    ---------------------------
 bool Parser::ParseRelationalOperator(void)
 {
-    Production p(*this, "relational_operator");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::RelationalOperator);
+    MarkStream m(journal);
 
     switch (tokens.Current()) {
     case TokenType::TOK_EQUAL:
@@ -24,9 +24,9 @@
 //    --------------------------
 bool Parser::ParseSelectedComponent(void)
 {
-    Production p(*this, "selected_component");
-    MarkStream m(tokens, diags);
-    std::string discard;
+    Production p(*this, ProdID::SelectedComponent);
+    MarkStream m(journal);
+    Atom_t discard;
 
     if (!ParsePrefix())                     return false;
     if (!Require(TokenType::TOK_DOT))                  return false;
@@ -45,8 +45,8 @@ bool Parser::ParseSelectedComponent(void)
 //    ------------------------------------------------------
 bool Parser::ParseName_SelectedComponentSuffix(void)
 {
-    Production p(*this, "selected_component(suffix)");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::SelectedComponentSuffix);
+    MarkStream m(journal);
 
     if (!Require(TokenType::TOK_DOT))           return false;
     if (!ParseSelector())                       return false;
@@ -24,16 +24,16 @@
 //    ----------------
 bool Parser::ParseSelector(void)
 {
-    Production p(*this, "selector");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::Selector);
+    MarkStream m(journal);
     Id id;
 
-    if (Optional(TokenType::TOK_ALL)) {
+    if (OptionalLeaf(TokenType::TOK_ALL)) {
         m.Commit();
         return true;
     }
 
-    if (Optional(TokenType::TOK_CHARACTER_LITERAL)) {
+    if (OptionalLeaf(TokenType::TOK_CHARACTER_LITERAL)) {
         m.Commit();
         return true;
     }
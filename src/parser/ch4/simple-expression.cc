@@ -22,28 +22,12 @@
 //
 // -- Parse a Simple Expression
 //    -------------------------
-bool Parser::ParseSimpleExpression(void)
+bool Parser::ParseSimpleExpression_Body(void)
 {
-    Production p(*this, "simple_expression");
-    MarkStream m(tokens, diags);
-
-    ParseUnaryAddingOperator();
-    if (!ParseTerm()) return false;
-    if (tokens.Current() == TokenType::TOK_COMMA || tokens.Current() == TokenType::TOK_ARROW)  {
-        // -- at this point we already have a good Term
-        m.Commit();
-        return true;
-    }
-
-
-    while (ParseBinaryAddingOperator()) {
-        if (!ParseTerm()) return false;
-        if (tokens.Current() == TokenType::TOK_COMMA || tokens.Current() == TokenType::TOK_ARROW) {
-            // -- at this point we already have a good Term
-            m.Commit();
-            return true;
-        }
-    }
+    Production p(*this, ProdID::SimpleExpression);
+    MarkStream m(journal);
+
+    if (!ParseExpression_Operators(ExprLevel::Adding)) return false;
 
     m.Commit();
     return true;
@@ -24,14 +24,14 @@
 //    ------------------------------------------------------------------
 bool Parser::ParseSimpleName(Id &id)
 {
-    Production p(*this, "simple_name");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::SimpleName);
+    MarkStream m(journal);
     SourceLoc_t loc = tokens.SourceLocation();
 
     if (!RequireIdent(id))  return false;
 
     if (scopes.Lookup(id.name) == nullptr) {
-        diags.Error(loc, DiagID::UnknownName, { id.name } );
+        diags.Error(loc, DiagID::UnknownName, { atoms.Spelling(id.name) } );
         // -- continue anyway
     }
 
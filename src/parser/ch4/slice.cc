@@ -24,8 +24,8 @@
 //    --------------
 bool Parser::ParseSlice(void)
 {
-    Production p(*this, "slice");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::Slice);
+    MarkStream m(journal);
 
     if (!ParsePrefix())                     return false;
     if (!Require(TokenType::TOK_LEFT_PARENTHESIS))     return false;
@@ -42,21 +42,3 @@ bool Parser::ParseSlice(void)
 
 
 
-//
-// -- Parse a Slice for Name
-//
-//    For this function, name has already been accounted for
-//    ------------------------------------------------------
-bool Parser::ParseName_SliceSuffix(void)
-{
-    Production p(*this, "slice(suffix)");
-    MarkStream m(tokens, diags);
-
-    if (!ParseDiscreteRange())                  return false;
-
-    m.Commit();
-    return true;
-}
-
-
-
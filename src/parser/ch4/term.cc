@@ -22,16 +22,12 @@
 //
 // -- Parse a Term
 //    ------------
-bool Parser::ParseTerm(void)
+bool Parser::ParseTerm_Body(void)
 {
-    Production p(*this, "term");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::Term);
+    MarkStream m(journal);
 
-    if (!ParseFactor()) return false;
-
-    while (ParseMultiplyingOperator()) {
-        if (!ParseFactor()) return false;
-    }
+    if (!ParseExpression_Operators(ExprLevel::Multiplying)) return false;
 
     m.Commit();
     return true;
@@ -24,8 +24,8 @@
 //    -----------------------
 bool Parser::ParseTypeConversion(void)
 {
-    Production p(*this, "type_conversion");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::TypeConversion);
+    MarkStream m(journal);
     SourceLoc_t loc;
 
     if (!ParseTypeMark())       return false;
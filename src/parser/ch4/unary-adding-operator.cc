@@ -24,8 +24,8 @@
 //    -----------------------------
 bool Parser::ParseUnaryAddingOperator(void)
 {
-    Production p(*this, "unary_adding_operator");
-    MarkStream m(tokens, diags);
+    Production p(*this, ProdID::UnaryAddingOperator);
+    MarkStream m(journal);
 
     switch (tokens.Current()) {
     case TokenType::TOK_PLUS:
@@ -0,0 +1,137 @@
+//=================================================================================================================
+//  profile.cc -- This is the implementation of the per-production profile of the parser
+//
+//        Copyright (c)  2025-2026 -- Adam Clark; See LICENSE.md
+//
+// ---------------------------------------------------------------------------------------------------------------
+//
+//     Date      Tracker  Version  Pgmr  Description
+//  -----------  -------  -------  ----  -------------------------------------------------------------------------
+//  2026-Oct-17  Initial   0.0.0   ADCL  Initial version
+//
+//=================================================================================================================
+
+
+#include "ada.hh"
+
+#include <algorithm>
+#include <fstream>
+
+
+
+//
+// -- A production has been entered
+//    -----------------------------
+void ParseProfile::Enter(ProdID id)
+{
+    Counts_t &c = counts[(size_t)id];
+
+    c.attempts ++;
+    c.active ++;
+    open.push_back(Frame_t { id, Clock::now(), 0 });
+}
+
+
+
+//
+// -- The innermost production has been left, having taken tokens or not
+//    ------------------------------------------------------------------
+void ParseProfile::Leave(bool took)
+{
+    assert(!open.empty());
+
+    Frame_t f = open.back();
+    Counts_t &c = counts[(size_t)f.id];
+    uint64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - f.start).count();
+
+    open.pop_back();
+
+    if (took) c.successes ++;
+    else c.failures ++;
+
+    c.active --;
+    if (c.active == 0) c.inclusive += elapsed;
+    c.exclusive += elapsed - std::min(elapsed, f.children);
+
+    if (!open.empty()) open.back().children += elapsed;
+}
+
+
+
+//
+// -- Print the productions which were tried, the most expensive (by exclusive time) first
+//    ------------------------------------------------------------------------------------
+void ParseProfile::Print(void) const
+{
+    std::vector<size_t> order;
+
+    for (size_t i = 0; i < std::size(productions); i ++) {
+        if (counts[i].attempts) order.push_back(i);
+    }
+
+    std::sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+        return counts[a].exclusive > counts[b].exclusive;
+    });
+
+    std::cerr << "=========================================\n";
+    std::cerr << "=========================================\n";
+    std::cerr << "====   Printing Parse Profile         ===\n";
+    std::cerr << "=========================================\n";
+    std::cerr << "=========================================\n";
+    std::cerr << '\n';
+
+    std::cerr << std::left << std::setw(36) << "production" << std::right
+            << std::setw(11) << "attempts" << std::setw(11) << "succeeded" << std::setw(11) << "failed"
+            << std::setw(11) << "rewound" << std::setw(11) << "diags" << std::setw(12) << "incl ms"
+            << std::setw(12) << "excl ms" << '\n';
+
+    for (size_t i : order) {
+        const Counts_t &c = counts[i];
+
+        std::cerr << std::left << std::setw(36) << productions[i].name << std::right
+                << std::setw(11) << c.attempts << std::setw(11) << c.successes << std::setw(11) << c.failures
+                << std::setw(11) << c.rewound << std::setw(11) << c.rolledBack
+                << std::setw(12) << std::fixed << std::setprecision(3) << c.inclusive / 1e6
+                << std::setw(12) << c.exclusive / 1e6 << '\n';
+    }
+
+    std::cerr << '\n';
+}
+
+
+
+//
+// -- Write the profile to `path` as JSON, one object per production tried
+//    --------------------------------------------------------------------
+bool ParseProfile::Json(const std::string &path) const
+{
+    std::ofstream out(path);
+    bool first = true;
+
+    if (!out) return false;
+
+    out << "[\n";
+
+    for (size_t i = 0; i < std::size(productions); i ++) {
+        const Counts_t &c = counts[i];
+        if (!c.attempts) continue;
+
+        if (!first) out << ",\n";
+        first = false;
+
+        out << "  { \"production\": \"" << productions[i].name << "\""
+                << ", \"attempts\": " << c.attempts
+                << ", \"successes\": " << c.successes
+                << ", \"failures\": " << c.failures
+                << ", \"tokensRewound\": " << c.rewound
+                << ", \"diagnosticsRolledBack\": " << c.rolledBack
+                << ", \"inclusiveNs\": " << c.inclusive
+                << ", \"exclusiveNs\": " << c.exclusive << " }";
+    }
+
+    out << "\n]\n";
+    return (bool)out;
+}
+
+
+
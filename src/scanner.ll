@@ -15,6 +15,8 @@
 %option yylineno
 %option noyywrap
 %option caseless
+%option reentrant
+%option extra-type="ScanContext_t *"
 
 
 /*
@@ -22,17 +24,22 @@
  *    -----------------------------------------------------------------
  */
 %{
+    #include <cstdint>
     #include <string>
     #include <iostream>
     #include <variant>
+    #include <deque>
+    #include <unordered_map>
+    #include <vector>
+    #include <string_view>
+    #include <mutex>
 
-    #define YY_DECL TokenType yylex(void)
-
-    extern int column;
-    extern std::string strVal;
-    std::string ToLower(const char *s);
+    #define YY_DECL TokenType yylex(yyscan_t yyscanner)
 
+    #include "atoms.hh"
+    #include "universal.hh"
     #include "tokens.hh"
+    #include "keywords.hh"
 %}
 
 
@@ -58,9 +65,9 @@ WS          [ \t]
          * -- handle some separator characters
          *    --------------------------------
          */
-{WS}        { column ++; }
-{LF}        { column = 1; }
---.*        { column += strlen(yytext); }
+{WS}        { yyextra->column ++; }
+{LF}        { yyextra->column = 1; }
+--.*        { yyextra->column += strlen(yytext); }
 
 
 
@@ -68,132 +75,66 @@ WS          [ \t]
          * -- handle the single character symbols
          *    -----------------------------------
          */
-\"          { column ++; BEGIN(str); strVal = ""; }
-&           { column ++; return TokenType::TOK_AMPERSAND; }
-\(          { column ++; return TokenType::TOK_LEFT_PARENTHESIS; }
-\)          { column ++; return TokenType::TOK_RIGHT_PARENTHESIS; }
-\*          { column ++; return TokenType::TOK_STAR; }
-\+          { column ++; return TokenType::TOK_PLUS; }
-,           { column ++; return TokenType::TOK_COMMA; }
--           { column ++; return TokenType::TOK_HYPHEN; }
-\.          { column ++; return TokenType::TOK_DOT; }
-\/          { column ++; return TokenType::TOK_SLASH; }
-\:          { column ++; return TokenType::TOK_COLON; }
-;           { column ++; return TokenType::TOK_SEMICOLON; }
-\<          { column ++; return TokenType::TOK_LESS_THAN; }
-=           { column ++; return TokenType::TOK_EQUAL; }
-\>          { column ++; return TokenType::TOK_GREATER_THAN; }
-_           { column ++; return TokenType::TOK_UNDERLINE; }
-\|          { column ++; return TokenType::TOK_VERTICAL_BAR; }
-!           { column ++; return TokenType::TOK_EXCLAMATION_MARK; }
-\$          { column ++; return TokenType::TOK_DOLLAR; }
-\%          { column ++; return TokenType::TOK_PERCENT; }
-\?          { column ++; return TokenType::TOK_QUESTION_MARK; }
-\@          { column ++; return TokenType::TOK_COMMERCIAL_AT; }
-\[          { column ++; return TokenType::TOK_LEFT_SQUARE_BRACKET; }
-\\          { column ++; return TokenType::TOK_BACK_SLASH; }
-\]          { column ++; return TokenType::TOK_RIGHT_SQUARE_BRACKET; }
-\^          { column ++; return TokenType::TOK_CIRCUMFLEX; }
-`           { column ++; return TokenType::TOK_GRAVE_ACCENT; }
-\{          { column ++; return TokenType::TOK_LEFT_BRACE; }
-\}          { column ++; return TokenType::TOK_RIGHT_BRACE; }
-~           { column ++; return TokenType::TOK_TILDE; }
+\"          { yyextra->column ++; BEGIN(str); yyextra->strStart = yytext + 1 - yyextra->base; yyextra->strEscaped = false; }
+&           { yyextra->column ++; return TokenType::TOK_AMPERSAND; }
+\(          { yyextra->column ++; return TokenType::TOK_LEFT_PARENTHESIS; }
+\)          { yyextra->column ++; return TokenType::TOK_RIGHT_PARENTHESIS; }
+\*          { yyextra->column ++; return TokenType::TOK_STAR; }
+\+          { yyextra->column ++; return TokenType::TOK_PLUS; }
+,           { yyextra->column ++; return TokenType::TOK_COMMA; }
+-           { yyextra->column ++; return TokenType::TOK_HYPHEN; }
+\.          { yyextra->column ++; return TokenType::TOK_DOT; }
+\/          { yyextra->column ++; return TokenType::TOK_SLASH; }
+\:          { yyextra->column ++; return TokenType::TOK_COLON; }
+;           { yyextra->column ++; return TokenType::TOK_SEMICOLON; }
+\<          { yyextra->column ++; return TokenType::TOK_LESS_THAN; }
+=           { yyextra->column ++; return TokenType::TOK_EQUAL; }
+\>          { yyextra->column ++; return TokenType::TOK_GREATER_THAN; }
+_           { yyextra->column ++; return TokenType::TOK_UNDERLINE; }
+\|          { yyextra->column ++; return TokenType::TOK_VERTICAL_BAR; }
+!           { yyextra->column ++; return TokenType::TOK_EXCLAMATION_MARK; }
+\$          { yyextra->column ++; return TokenType::TOK_DOLLAR; }
+\%          { yyextra->column ++; return TokenType::TOK_PERCENT; }
+\?          { yyextra->column ++; return TokenType::TOK_QUESTION_MARK; }
+\@          { yyextra->column ++; return TokenType::TOK_COMMERCIAL_AT; }
+\[          { yyextra->column ++; return TokenType::TOK_LEFT_SQUARE_BRACKET; }
+\\          { yyextra->column ++; return TokenType::TOK_BACK_SLASH; }
+\]          { yyextra->column ++; return TokenType::TOK_RIGHT_SQUARE_BRACKET; }
+\^          { yyextra->column ++; return TokenType::TOK_CIRCUMFLEX; }
+`           { yyextra->column ++; return TokenType::TOK_GRAVE_ACCENT; }
+\{          { yyextra->column ++; return TokenType::TOK_LEFT_BRACE; }
+\}          { yyextra->column ++; return TokenType::TOK_RIGHT_BRACE; }
+~           { yyextra->column ++; return TokenType::TOK_TILDE; }
 
 
         /*
          * -- handle the compound symbols
          *    ---------------------------
          */
-\=\>        { column += 2; return TokenType::TOK_ARROW; }
-\.\.        { column += 2; return TokenType::TOK_DOUBLE_DOT; }
-\*\*        { column += 2; return TokenType::TOK_DOUBLE_STAR; }
-\:\=        { column += 2; return TokenType::TOK_ASSIGNMENT; }
-\/\=        { column += 2; return TokenType::TOK_INEQUALITY; }
-\>\=        { column += 2; return TokenType::TOK_GREATER_THAN_OR_EQUAL; }
-\<\=        { column += 2; return TokenType::TOK_LESS_THAN_OR_EQUAL; }
-\<\<        { column += 2; return TokenType::TOK_LEFT_LABEL_BRACKET; }
-\>\>        { column += 2; return TokenType::TOK_RIGHT_LABEL_BRACKET; }
-\<\>        { column += 2; return TokenType::TOK_BOX; }
-
-
-        /*
-        * -- handle keywords
-        *    ---------------
-        */
-abort       { column += strlen(yytext); return TokenType::TOK_ABORT; }
-abs         { column += strlen(yytext); return TokenType::TOK_ABS; }
-accept      { column += strlen(yytext); return TokenType::TOK_ACCEPT; }
-access      { column += strlen(yytext); return TokenType::TOK_ACCESS; }
-all         { column += strlen(yytext); return TokenType::TOK_ALL; }
-and         { column += strlen(yytext); return TokenType::TOK_AND; }
-array       { column += strlen(yytext); return TokenType::TOK_ARRAY; }
-at          { column += strlen(yytext); return TokenType::TOK_AT; }
-begin       { column += strlen(yytext); return TokenType::TOK_BEGIN; }
-body        { column += strlen(yytext); return TokenType::TOK_BODY; }
-case        { column += strlen(yytext); return TokenType::TOK_CASE; }
-constant    { column += strlen(yytext); return TokenType::TOK_CONSTANT; }
-declare     { column += strlen(yytext); return TokenType::TOK_DECLARE; }
-delay       { column += strlen(yytext); return TokenType::TOK_DELAY; }
-delta       { column += strlen(yytext); return TokenType::TOK_DELTA; }
-digits      { column += strlen(yytext); return TokenType::TOK_DIGITS; }
-do          { column += strlen(yytext); return TokenType::TOK_DO; }
-else        { column += strlen(yytext); return TokenType::TOK_ELSE; }
-elsif       { column += strlen(yytext); return TokenType::TOK_ELSIF; }
-end         { column += strlen(yytext); return TokenType::TOK_END; }
-entry       { column += strlen(yytext); return TokenType::TOK_ENTRY; }
-exception   { column += strlen(yytext); return TokenType::TOK_EXCEPTION; }
-exit        { column += strlen(yytext); return TokenType::TOK_EXIT; }
-for         { column += strlen(yytext); return TokenType::TOK_FOR; }
-function    { column += strlen(yytext); return TokenType::TOK_FUNCTION; }
-generic     { column += strlen(yytext); return TokenType::TOK_GENERIC; }
-goto        { column += strlen(yytext); return TokenType::TOK_GOTO; }
-if          { column += strlen(yytext); return TokenType::TOK_IF; }
-in          { column += strlen(yytext); return TokenType::TOK_IN; }
-is          { column += strlen(yytext); return TokenType::TOK_IS; }
-limited     { column += strlen(yytext); return TokenType::TOK_LIMITED; }
-loop        { column += strlen(yytext); return TokenType::TOK_LOOP; }
-mod         { column += strlen(yytext); return TokenType::TOK_MOD; }
-new         { column += strlen(yytext); return TokenType::TOK_NEW; }
-not         { column += strlen(yytext); return TokenType::TOK_NOT; }
-null        { column += strlen(yytext); return TokenType::TOK_NULL; }
-of          { column += strlen(yytext); return TokenType::TOK_OF; }
-or          { column += strlen(yytext); return TokenType::TOK_OR; }
-others      { column += strlen(yytext); return TokenType::TOK_OTHERS; }
-out         { column += strlen(yytext); return TokenType::TOK_OUT; }
-package     { column += strlen(yytext); return TokenType::TOK_PACKAGE; }
-pragma      { column += strlen(yytext); BEGIN(prg); return TokenType::TOK_PRAGMA; }
-private     { column += strlen(yytext); return TokenType::TOK_PRIVATE; }
-procedure   { column += strlen(yytext); return TokenType::TOK_PROCEDURE; }
-raise       { column += strlen(yytext); return TokenType::TOK_RAISE; }
-range       { column += strlen(yytext); return TokenType::TOK_RANGE; }
-record      { column += strlen(yytext); return TokenType::TOK_RECORD; }
-rem         { column += strlen(yytext); return TokenType::TOK_REM; }
-renames     { column += strlen(yytext); return TokenType::TOK_RENAMES; }
-return      { column += strlen(yytext); return TokenType::TOK_RETURN; }
-reverse     { column += strlen(yytext); return TokenType::TOK_REVERSE; }
-select      { column += strlen(yytext); return TokenType::TOK_SELECT; }
-separate    { column += strlen(yytext); return TokenType::TOK_SEPARATE; }
-subtype     { column += strlen(yytext); return TokenType::TOK_SUBTYPE; }
-task        { column += strlen(yytext); return TokenType::TOK_TASK; }
-terminate   { column += strlen(yytext); return TokenType::TOK_TERMINATE; }
-then        { column += strlen(yytext); return TokenType::TOK_THEN; }
-type        { column += strlen(yytext); return TokenType::TOK_TYPE; }
-use         { column += strlen(yytext); return TokenType::TOK_USE; }
-when        { column += strlen(yytext); return TokenType::TOK_WHEN; }
-while       { column += strlen(yytext); return TokenType::TOK_WHILE; }
-with        { column += strlen(yytext); return TokenType::TOK_WITH; }
-xor         { column += strlen(yytext); return TokenType::TOK_XOR; }
-
+\=\>        { yyextra->column += 2; return TokenType::TOK_ARROW; }
+\.\.        { yyextra->column += 2; return TokenType::TOK_DOUBLE_DOT; }
+\*\*        { yyextra->column += 2; return TokenType::TOK_DOUBLE_STAR; }
+\:\=        { yyextra->column += 2; return TokenType::TOK_ASSIGNMENT; }
+\/\=        { yyextra->column += 2; return TokenType::TOK_INEQUALITY; }
+\>\=        { yyextra->column += 2; return TokenType::TOK_GREATER_THAN_OR_EQUAL; }
+\<\=        { yyextra->column += 2; return TokenType::TOK_LESS_THAN_OR_EQUAL; }
+\<\<        { yyextra->column += 2; return TokenType::TOK_LEFT_LABEL_BRACKET; }
+\>\>        { yyextra->column += 2; return TokenType::TOK_RIGHT_LABEL_BRACKET; }
+\<\>        { yyextra->column += 2; return TokenType::TOK_BOX; }
 
 
         /*
-         * -- handle other identifiers which are not keywords
-         *    -----------------------------------------------
+         * -- handle identifiers, which may be reserved words (see keywords.hh)
+         *    -----------------------------------------------------------------
          */
 {LETTER}({UNDERLINE}|{LETTER}|{DIGIT})* {
-                column += strlen(yytext);
-                std::string lower = ToLower(yytext);
-                yylval = IdentifierLexeme { lower };
+                TokenType tok = Keyword(yytext, yyleng);
+
+                yyextra->column += yyleng;
+                if (tok == TokenType::TOK_PRAGMA) BEGIN(prg);
+                if (tok != TokenType::TOK_IDENTIFIER) return tok;
+
+                yyextra->payload = IdentifierLexeme { atoms.InternFolded(yytext, yyleng) };
                 return TokenType::TOK_IDENTIFIER;
             }
 
@@ -204,28 +145,34 @@ xor         { column += strlen(yytext); return TokenType::TOK_XOR; }
          *    ------------------------------------------------------
          */
 {DIGIT}({UNDERLINE}|{DIGIT})*#{HEXDIGIT}({UNDERLINE}|{HEXDIGIT})*# {
-                 column += strlen(yytext);
+                yyextra->column += yyleng;
+                yyextra->payload = NumericLiteral { literals.AddInteger(yytext, yyleng) };
                 return TokenType::TOK_UNIVERSAL_INT_LITERAL;
             }
 {DIGIT}({UNDERLINE}|{DIGIT})*#{HEXDIGIT}({UNDERLINE}|{HEXDIGIT})*#e\+?{DIGIT}({UNDERLINE}|{DIGIT})* {
-                 column += strlen(yytext);
+                yyextra->column += yyleng;
+                yyextra->payload = NumericLiteral { literals.AddInteger(yytext, yyleng) };
                 return TokenType::TOK_UNIVERSAL_INT_LITERAL;
             }
 {DIGIT}({UNDERLINE}|{DIGIT})*#{HEXDIGIT}({UNDERLINE}|{HEXDIGIT})*#e-{DIGIT}({UNDERLINE}|{DIGIT})* {
-                 column += strlen(yytext);
+                yyextra->column += yyleng;
+                yyextra->payload = NumericLiteral { literals.AddInteger(yytext, yyleng) };
                 return TokenType::TOK_UNIVERSAL_INT_LITERAL;
             }
 
 {DIGIT}({UNDERLINE}|{DIGIT})* {
-                 column += strlen(yytext);
+                yyextra->column += yyleng;
+                yyextra->payload = NumericLiteral { literals.AddInteger(yytext, yyleng) };
                 return TokenType::TOK_UNIVERSAL_INT_LITERAL;
             }
 {DIGIT}({UNDERLINE}|{DIGIT})*e\+?{DIGIT}({UNDERLINE}|{DIGIT})* {
-                 column += strlen(yytext);
+                yyextra->column += yyleng;
+                yyextra->payload = NumericLiteral { literals.AddInteger(yytext, yyleng) };
                 return TokenType::TOK_UNIVERSAL_INT_LITERAL;
             }
 {DIGIT}({UNDERLINE}|{DIGIT})*e-{DIGIT}({UNDERLINE}|{DIGIT})* {
-                 column += strlen(yytext);
+                yyextra->column += yyleng;
+                yyextra->payload = NumericLiteral { literals.AddInteger(yytext, yyleng) };
                 return TokenType::TOK_UNIVERSAL_INT_LITERAL;
             }
 
@@ -236,28 +183,34 @@ xor         { column += strlen(yytext); return TokenType::TOK_XOR; }
          *    ---------------------------------------------------
          */
 {DIGIT}({UNDERLINE}|{DIGIT})*\.{DIGIT}({UNDERLINE}|{DIGIT})* {
-                 column += strlen(yytext);
+                yyextra->column += yyleng;
+                yyextra->payload = NumericLiteral { literals.AddReal(yytext, yyleng) };
                 return TokenType::TOK_UNIVERSAL_REAL_LITERAL;
             }
 {DIGIT}({UNDERLINE}|{DIGIT})*\.{DIGIT}({UNDERLINE}|{DIGIT})*e\+?{DIGIT}({UNDERLINE}|{DIGIT})* {
-                 column += strlen(yytext);
+                yyextra->column += yyleng;
+                yyextra->payload = NumericLiteral { literals.AddReal(yytext, yyleng) };
                 return TokenType::TOK_UNIVERSAL_REAL_LITERAL;
             }
 {DIGIT}({UNDERLINE}|{DIGIT})*\.{DIGIT}({UNDERLINE}|{DIGIT})*e-{DIGIT}({UNDERLINE}|{DIGIT})* {
-                 column += strlen(yytext);
+                yyextra->column += yyleng;
+                yyextra->payload = NumericLiteral { literals.AddReal(yytext, yyleng) };
                 return TokenType::TOK_UNIVERSAL_REAL_LITERAL;
             }
 
 {DIGIT}({UNDERLINE}|{DIGIT})*#{HEXDIGIT}({UNDERLINE}|{HEXDIGIT})*\.{HEXDIGIT}({UNDERLINE}|{HEXDIGIT})*# {
-                 column += strlen(yytext);
+                yyextra->column += yyleng;
+                yyextra->payload = NumericLiteral { literals.AddReal(yytext, yyleng) };
                 return TokenType::TOK_UNIVERSAL_REAL_LITERAL;
             }
 {DIGIT}({UNDERLINE}|{DIGIT})*#{HEXDIGIT}({UNDERLINE}|{HEXDIGIT})*\.{HEXDIGIT}({UNDERLINE}|{HEXDIGIT})*#e\+?{DIGIT}({UNDERLINE}|{DIGIT})* {
-                 column += strlen(yytext);
+                yyextra->column += yyleng;
+                yyextra->payload = NumericLiteral { literals.AddReal(yytext, yyleng) };
                 return TokenType::TOK_UNIVERSAL_REAL_LITERAL;
             }
 {DIGIT}({UNDERLINE}|{DIGIT})*#{HEXDIGIT}({UNDERLINE}|{HEXDIGIT})*\.{HEXDIGIT}({UNDERLINE}|{HEXDIGIT})*#e-{DIGIT}({UNDERLINE}|{DIGIT})* {
-                 column += strlen(yytext);
+                yyextra->column += yyleng;
+                yyextra->payload = NumericLiteral { literals.AddReal(yytext, yyleng) };
                 return TokenType::TOK_UNIVERSAL_REAL_LITERAL;
             }
 
@@ -268,9 +221,8 @@ xor         { column += strlen(yytext); return TokenType::TOK_XOR; }
          *    --------------------------
          */
 \'.\'       {
-                column += strlen(yytext);
-                CharLiteral ch;
-                yylval = CharLiteral { std::string(yytext), yytext[1] };
+                yyextra->column += strlen(yytext);
+                yyextra->payload = CharLiteral { (uint32_t)(yytext - yyextra->base), yytext[1] };
                 return TokenType::TOK_CHARACTER_LITERAL;
             }
 
@@ -280,10 +232,15 @@ xor         { column += strlen(yytext); return TokenType::TOK_XOR; }
          * -- Handle a string literal
          *    -----------------------
          */
-<str>\"     { column ++; BEGIN(INITIAL); return TokenType::TOK_STRING_LITERAL; }
-<str>{LF}   { column = 0; BEGIN(INITIAL); return TokenType::TOK_ERROR; }
-<str>\"\"   { column += 2; strVal += '"'; }
-<str>.      { column ++; strVal += yytext[0]; }
+<str>\"     {
+                yyextra->column ++;
+                BEGIN(INITIAL);
+                yyextra->payload = StringLiteral { yyextra->strStart, (uint32_t)(yytext - yyextra->base) - yyextra->strStart, yyextra->strEscaped };
+                return TokenType::TOK_STRING_LITERAL;
+            }
+<str>{LF}   { yyextra->column = 0; BEGIN(INITIAL); return TokenType::TOK_ERROR; }
+<str>\"\"   { yyextra->column += 2; yyextra->strEscaped = true; }
+<str>.      { yyextra->column ++; }
 
 
 
@@ -291,28 +248,27 @@ xor         { column += strlen(yytext); return TokenType::TOK_XOR; }
          * -- determine which pragma name we are parsing and its args
          *    -------------------------------------------------------
          */
-<prg>{WS}   { column ++; }
-<prg>{LF}   { column = 0; BEGIN(INITIAL); return TokenType::TOK_ERROR; }
+<prg>{WS}   { yyextra->column ++; }
+<prg>{LF}   { yyextra->column = 0; BEGIN(INITIAL); return TokenType::TOK_ERROR; }
 <prg>{LETTER}({UNDERLINE}|{LETTER}|{DIGIT})* {
-                column += strlen(yytext);
+                yyextra->column += strlen(yytext);
                 BEGIN(arg);
                 return TokenType::TOK_PRAGMA_NAME;
             }
-<prg>.      { column ++; BEGIN(INITIAL); return TokenType::TOK_ERROR; }
-
-<arg>{WS}   { column ++; }
-<arg>;      { column ++; BEGIN(INITIAL); return TokenType::TOK_SEMICOLON; }
-<arg>\(     { column ++; return TokenType::TOK_LEFT_PARENTHESIS; }
-<arg>\)     { column ++; BEGIN(INITIAL); return TokenType::TOK_RIGHT_PARENTHESIS; }
-<arg>,      { column ++; return TokenType::TOK_COMMA; }
-<arg>\=\>   { column += 2; return TokenType::TOK_ARROW; }
+<prg>.      { yyextra->column ++; BEGIN(INITIAL); return TokenType::TOK_ERROR; }
+
+<arg>{WS}   { yyextra->column ++; }
+<arg>;      { yyextra->column ++; BEGIN(INITIAL); return TokenType::TOK_SEMICOLON; }
+<arg>\(     { yyextra->column ++; return TokenType::TOK_LEFT_PARENTHESIS; }
+<arg>\)     { yyextra->column ++; BEGIN(INITIAL); return TokenType::TOK_RIGHT_PARENTHESIS; }
+<arg>,      { yyextra->column ++; return TokenType::TOK_COMMA; }
+<arg>\=\>   { yyextra->column += 2; return TokenType::TOK_ARROW; }
 <arg>{LETTER}({UNDERLINE}|{LETTER}|{DIGIT})* {
-                column += strlen(yytext);
-                std::string lower = ToLower(yytext);
-                yylval = IdentifierLexeme { lower };
+                yyextra->column += yyleng;
+                yyextra->payload = IdentifierLexeme { atoms.InternFolded(yytext, yyleng) };
                 return TokenType::TOK_IDENTIFIER;
             }
-<arg>.      { column ++; BEGIN(INITIAL); return TokenType::TOK_ERROR; }
+<arg>.      { yyextra->column ++; BEGIN(INITIAL); return TokenType::TOK_ERROR; }
 
 
 
@@ -321,26 +277,65 @@ xor         { column += strlen(yytext); return TokenType::TOK_XOR; }
          *    ----------
          */
 <*><<EOF>>  { return TokenType::YYEOF; }
-'           { column ++; return TokenType::TOK_APOSTROPHE; }
-#           { column ++; return TokenType::TOK_SHARP; }
-.           { column ++; return TokenType::TOK_ERROR; }
+'           { yyextra->column ++; return TokenType::TOK_APOSTROPHE; }
+#           { yyextra->column ++; return TokenType::TOK_SHARP; }
+.           { yyextra->column ++; return TokenType::TOK_ERROR; }
 
 
 %%
 
-std::string strVal;
-YYSTYPE yylval;
-
 
 
 
-std::string ToLower(const char *s)
+//
+// -- Create a scanner over a buffer in memory.  The buffer must end with 2 NUL bytes, which are
+//    included in `size`.  The scanner works from the buffer directly and does not copy it.  All
+//    of the scanner state lives in the scanner and `ctx`, so each thread may run its own.
+//    ------------------------------------------------------------------------------------------
+void *ScanBegin(ScanContext_t *ctx, char *base, size_t size)
 {
-    std::string rv;
+    yyscan_t scanner;
 
-    for (int i = 0; i < strlen(s); i ++) {
-        rv.push_back(s[i] >= 'A' && s[i] <= 'Z' ? s[i] - 'A' + 'a' : s[i]);
+    ctx->base = base;
+    ctx->column = 1;
+    ctx->payload = std::monostate {};
+
+    if (yylex_init_extra(ctx, &scanner) != 0) return nullptr;
+
+    if (yy_scan_buffer(base, size, scanner) == nullptr) {
+        yylex_destroy(scanner);
+        return nullptr;
     }
 
-    return rv;
+    yyset_lineno(0, scanner);           // set to 0 to make everything happy!
+    return scanner;
+}
+
+
+
+//
+// -- Release the scanner and its buffer state once the scan is complete
+//    ------------------------------------------------------------------
+void ScanEnd(void *scanner)
+{
+    yylex_destroy(scanner);
+}
+
+
+
+//
+// -- Report on the text matched last
+//    -------------------------------
+uint32_t ScanLine(void *scanner) { return yyget_lineno(scanner); }
+std::string_view ScanText(void *scanner) { return std::string_view(yyget_text(scanner), yyget_leng(scanner)); }
+
+
+
+//
+// -- Is the scanner in the INITIAL start condition?
+//    ----------------------------------------------
+bool ScanInitial(void *scanner)
+{
+    struct yyguts_t *yyg = (struct yyguts_t *)scanner;
+    return YY_START == INITIAL;
 }
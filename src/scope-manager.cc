@@ -32,27 +32,27 @@ ScopeManager::ScopeManager(void)
     //
     // -- Take care of the internal fundamental types
     //    -------------------------------------------
-    Declare(std::make_unique<IntegerTypeSymbol>("integer", tokens->EmptyLocation(), declScope));
-    Declare(std::make_unique<ArrayTypeSymbol>("array", tokens->EmptyLocation(), declScope));
-    Declare(std::make_unique<RealTypeSymbol>("real", tokens->EmptyLocation(), declScope));
-    Declare(std::make_unique<EnumTypeSymbol>("character", tokens->EmptyLocation(), declScope));
-    Declare(std::make_unique<ArrayTypeSymbol>("string", tokens->EmptyLocation(), declScope));
+    Declare(std::make_unique<IntegerTypeSymbol>(atoms.Intern("integer"), tokens->EmptyLocation(), declScope));
+    Declare(std::make_unique<ArrayTypeSymbol>(atoms.Intern("array"), tokens->EmptyLocation(), declScope));
+    Declare(std::make_unique<RealTypeSymbol>(atoms.Intern("real"), tokens->EmptyLocation(), declScope));
+    Declare(std::make_unique<EnumTypeSymbol>(atoms.Intern("character"), tokens->EmptyLocation(), declScope));
+    Declare(std::make_unique<ArrayTypeSymbol>(atoms.Intern("string"), tokens->EmptyLocation(), declScope));
 
 
     //
     // -- Create the boolean enumeration
     //    ------------------------------
-    std::unique_ptr<EnumTypeSymbol> b = std::make_unique<EnumTypeSymbol>("boolean", tokens->EmptyLocation(), declScope);
+    std::unique_ptr<EnumTypeSymbol> b = std::make_unique<EnumTypeSymbol>(atoms.Intern("boolean"), tokens->EmptyLocation(), declScope);
     EnumTypeSymbol *bTyp = b.get();
     Declare(std::move(b));
 
     std::unique_ptr<EnumLiteralSymbol> f;
-    f = std::make_unique<EnumLiteralSymbol>("false", bTyp, 0, TokenStream::EmptyLocation(), declScope);
+    f = std::make_unique<EnumLiteralSymbol>(atoms.Intern("false"), bTyp, 0, TokenStream::EmptyLocation(), declScope);
     bTyp->literals.push_back(f.get());
     Declare(std::move(f));
 
     std::unique_ptr<EnumLiteralSymbol> t;
-    t = std::make_unique<EnumLiteralSymbol>("true", bTyp, 1, tokens->EmptyLocation(), declScope);
+    t = std::make_unique<EnumLiteralSymbol>(atoms.Intern("true"), bTyp, 1, tokens->EmptyLocation(), declScope);
     bTyp->literals.push_back(t.get());
     Declare(std::move(t));
 
@@ -61,46 +61,46 @@ ScopeManager::ScopeManager(void)
     //
     // -- create all the possible attribute names
     //    ---------------------------------------
-    Declare(std::make_unique<AttributeSymbol>("address", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("aft", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("base", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("callable", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("constrained", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("count", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("delta", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("digits", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("emax", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("epsilon", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("first", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("first_bit", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("fore", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("image", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("large", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("last", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("last_bit", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("length", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("machine_emax", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("machine_emin", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("machine_mastissa", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("machine_overflows", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("machine_radix", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("machine_rounds", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("mantissa", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("pos", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("position", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("pred", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("range", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("safe_emax", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("safe_large", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("safe_small", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("size", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("small", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("storage_size", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("succ", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("terminated", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("val", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("value", TokenStream::EmptyLocation(), declScope));
-    Declare(std::make_unique<AttributeSymbol>("width", TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("address"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("aft"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("base"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("callable"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("constrained"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("count"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("delta"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("digits"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("emax"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("epsilon"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("first"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("first_bit"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("fore"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("image"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("large"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("last"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("last_bit"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("length"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("machine_emax"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("machine_emin"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("machine_mastissa"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("machine_overflows"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("machine_radix"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("machine_rounds"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("mantissa"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("pos"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("position"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("pred"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("range"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("safe_emax"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("safe_large"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("safe_small"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("size"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("small"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("storage_size"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("succ"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("terminated"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("val"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("value"), TokenStream::EmptyLocation(), declScope));
+    Declare(std::make_unique<AttributeSymbol>(atoms.Intern("width"), TokenStream::EmptyLocation(), declScope));
 
 
 
@@ -117,8 +117,11 @@ ScopeManager::ScopeManager(void)
 //    ---------------------------------------------
 void ScopeManager::PushScope(Scope::ScopeKind kind, std::string name)
 {
+    if (journal) journal->Pushed(current);
+
     stack.push_back(std::make_unique<Scope>(CurrentScope()->Parent(), kind, CurrentScope()->Level() + 1, name));
     current = stack.back().get();
+    Changed();
 }
 
 
@@ -132,7 +135,34 @@ void ScopeManager::PopScope(void)
         exit(EXIT_FAILURE);
     }
 
+    if (journal) journal->Popped(current);
+
     current = current->Parent();
+    Changed();
+}
+
+
+
+//
+// -- Note a symbol about to be declared in `scope`, so that a rollback can take it back
+//    ----------------------------------------------------------------------------------
+void ScopeManager::Declared(Scope *scope)
+{
+    if (journal) journal->Declared(scope);
+    Changed();
+}
+
+
+
+//
+// -- Retire a symbol (an incomplete type which has been completed), keeping what it was for a rollback
+//    -------------------------------------------------------------------------------------------------
+void ScopeManager::Retire(Symbol *sym)
+{
+    if (journal) journal->Retired(sym, sym->kind);
+
+    sym->kind = Symbol::SymbolKind::Deleted;
+    Changed();
 }
 
 
@@ -140,7 +170,7 @@ void ScopeManager::PopScope(void)
 //
 // -- Look for a symbol in all the scopes
 //    -----------------------------------
-const std::vector<Symbol *> *ScopeManager::Lookup(std::string_view name) const
+const std::vector<Symbol *> *ScopeManager::Lookup(Atom_t name) const
 {
     for (auto it = stack.rbegin(); it != stack.rend(); it ++) {
         const std::vector<Symbol *> *vec = it->get()->LocalLookup(name);
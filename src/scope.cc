@@ -32,23 +32,23 @@ Scope::Scope(Scope *parent, ScopeKind kind, int level, std::string name)
 
 
 //
-// -- Perform a rollback if we are not keeping the changes
-//    ----------------------------------------------------
-void Scope::Rollback(size_t cp)
+// -- Take back the symbol declared last, when the parse which declared it is rolled back
+//    -----------------------------------------------------------------------------------
+void Scope::Undeclare(void)
 {
-    while (ordered.size() > cp) {
-        Symbol *sym = ordered.back().get();
-        auto it = index.find(sym->name);
-        if (it != index.end()) {
-            auto &vec = it->second;
-            vec.pop_back();
-            if (vec.empty()) {
-                index.erase(it);
-            }
+    assert(!ordered.empty());
+
+    Symbol *sym = ordered.back().get();
+    auto it = index.find(sym->name);
+    if (it != index.end()) {
+        auto &vec = it->second;
+        vec.pop_back();
+        if (vec.empty()) {
+            index.erase(it);
         }
-
-        ordered.pop_back();
     }
+
+    ordered.pop_back();
 }
 
 
@@ -56,9 +56,9 @@ void Scope::Rollback(size_t cp)
 //
 // -- perform a lookup of the symnbol name in this scope
 //    --------------------------------------------------
-std::vector<Symbol *> *Scope::LocalLookup(std::string_view name)
+std::vector<Symbol *> *Scope::LocalLookup(Atom_t name)
 {
-    auto it = index.find(std::string(name));
+    auto it = index.find(name);
     if (it == index.end()) {
         return nullptr;
     }
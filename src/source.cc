@@ -0,0 +1,212 @@
+//=================================================================================================================
+//  source.cc -- Implementation of a source file loaded into memory
+//
+//        Copyright (c)  2025-2026 -- Adam Clark; See LICENSE.md
+//
+// ---------------------------------------------------------------------------------------------------------------
+//
+//     Date      Tracker  Version  Pgmr  Description
+//  -----------  -------  -------  ----  -------------------------------------------------------------------------
+//  2026-Oct-17  Initial   0.0.0   ADCL  Initial version
+//
+//=================================================================================================================
+
+
+
+#include "ada.hh"
+
+#include <algorithm>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+
+
+//
+// -- Load the source file.  The file is mapped privately with a zero-filled anonymous mapping reserved
+//    behind it, so that the 2 NUL bytes flex requires at the end of the buffer are always present without
+//    having to copy the file.  When the file cannot be opened, stdin is read into a heap buffer instead.
+//    ------------------------------------------------------------------------------------------------------
+SourceFile::SourceFile(const char *fn) : name(fn?fn:"stdin"), base(nullptr), size(0), mapped(0), valid(false)
+{
+    int fd = fn ? open(fn, O_RDONLY) : -1;
+    struct stat st;
+
+    if (fd >= 0 && fstat(fd, &st) == 0 && S_ISREG(st.st_mode)) {
+        size_t page = sysconf(_SC_PAGESIZE);
+
+        size = st.st_size;
+        mapped = (size + 2 + page - 1) / page * page;
+
+        void *p = mmap(nullptr, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (p != MAP_FAILED && size) {
+            if (mmap(p, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED) {
+                munmap(p, mapped);
+                p = MAP_FAILED;
+            }
+        }
+
+        if (p != MAP_FAILED) {
+            base = static_cast<char *>(p);
+            valid = true;
+        } else {
+            mapped = 0;
+            size = 0;
+        }
+    }
+
+
+    if (!valid) {
+        //
+        // -- fall back to reading the file (or stdin) into the heap
+        //    ------------------------------------------------------
+        FILE *fp = fn ? fopen(fn, "r") : nullptr;
+
+        if (fp) {
+            Slurp(fp);
+            fclose(fp);
+            valid = true;
+        } else {
+            std::cerr << "Unable to open file; using stdin.\n";
+            std::cerr << "   Ctrl-c to stop; Ctrl-d for EOF\n";
+            Slurp(stdin);
+        }
+    }
+
+    if (fd >= 0) close(fd);
+
+    IndexLines();
+}
+
+
+
+//
+// -- Release the source file
+//    -----------------------
+SourceFile::~SourceFile()
+{
+    if (mapped) munmap(base, mapped);
+}
+
+
+
+//
+// -- Read a stream which cannot be mapped into the heap buffer
+//    ---------------------------------------------------------
+void SourceFile::Slurp(FILE *fp)
+{
+    char buf[8192];
+    size_t n;
+
+    heap.clear();
+    while ((n = fread(buf, 1, sizeof(buf), fp)) > 0) {
+        heap.insert(heap.end(), buf, buf + n);
+    }
+
+    size = heap.size();
+    heap.push_back('\0');
+    heap.push_back('\0');
+    base = heap.data();
+}
+
+
+
+//
+// -- Build the index of line starting offsets.  Lines are broken on '\n' only, which is
+//    exactly how the scanner counts `yylineno`.
+//    ----------------------------------------------------------------------------------
+void SourceFile::IndexLines(void)
+{
+    lines.clear();
+    if (size == 0) return;
+
+    lines.push_back(0);
+
+    const char *p = base;
+    const char *end = base + size;
+
+    while ((p = static_cast<const char *>(memchr(p, '\n', end - p))) != nullptr) {
+        if (++ p == end) break;
+        lines.push_back(p - base);
+    }
+}
+
+
+
+//
+// -- Get the text of a line (0-based), without the line terminator
+//    -------------------------------------------------------------
+std::string_view SourceFile::Line(size_t l) const
+{
+    if (l >= lines.size()) return std::string_view();
+
+    size_t start = lines[l];
+    size_t end = (l + 1 < lines.size()) ? lines[l + 1] : size;
+
+    while (end > start && (base[end - 1] == '\n' || base[end - 1] == '\r')) end --;
+
+    return std::string_view(base + start, end - start);
+}
+
+
+
+//
+// -- Get the line (0-based) holding the character at `offset`
+//    --------------------------------------------------------
+size_t SourceFile::LineOf(size_t offset) const
+{
+    size_t l = std::upper_bound(lines.begin(), lines.end(), offset) - lines.begin();
+
+    return l ? l - 1 : 0;
+}
+
+
+
+//
+// -- Replace `removed` bytes at `offset` with `text`.  A mapped file is first copied to the heap, since
+//    the mapping cannot grow.  The line starts within the edit are found again and those after it are
+//    moved along; an edit which reaches the end of the text simply indexes the lines again.
+//    --------------------------------------------------------------------------------------------------
+void SourceFile::Replace(size_t offset, size_t removed, std::string_view text)
+{
+    size_t oldSize = size;
+
+    if (mapped) {
+        heap.assign(base, base + size + 2);
+        munmap(base, mapped);
+        mapped = 0;
+    }
+
+    if (text.size() > removed) heap.insert(heap.begin() + offset + removed, text.size() - removed, '\0');
+    else heap.erase(heap.begin() + offset + text.size(), heap.begin() + offset + removed);
+
+    std::copy(text.begin(), text.end(), heap.begin() + offset);
+    base = heap.data();
+    size = heap.size() - 2;
+
+    if (offset + removed >= oldSize) {
+        IndexLines();
+        return;
+    }
+
+
+    //
+    // -- a line start after `offset` up to the end of the removed text followed a removed line feed
+    //    ------------------------------------------------------------------------------------------
+    auto lo = std::upper_bound(lines.begin(), lines.end(), offset);
+    auto hi = std::upper_bound(lo, lines.end(), offset + removed);
+    std::vector<size_t> added;
+
+    for (size_t i = 0; i < text.size(); i ++) {
+        if (text[i] == '\n') added.push_back(offset + i + 1);
+    }
+
+    for (auto it = hi; it != lines.end(); ++ it) *it += text.size() - removed;
+
+    size_t at = lo - lines.begin();
+    lines.erase(lo, hi);
+    lines.insert(lines.begin() + at, added.begin(), added.end());
+}
@@ -0,0 +1,365 @@
+//=================================================================================================================
+//  token-cache.cc -- Saving token streams to disk and loading them back
+//
+//        Copyright (c)  2025-2026 -- Adam Clark; See LICENSE.md
+//
+//  The image is laid out as a header followed by these sections, each starting on an 8-byte boundary:
+//  * the token kinds
+//  * the token positions
+//  * the payload records, one for each entry in the payload table
+//  * the offsets of the identifier spellings, and then the spellings themselves
+//  * the literal values, as 32-bit words
+//
+//  The image is only ever read back by the same build on the same machine, so everything is written in
+//  its native layout.
+//
+// ---------------------------------------------------------------------------------------------------------------
+//
+//     Date      Tracker  Version  Pgmr  Description
+//  -----------  -------  -------  ----  -------------------------------------------------------------------------
+//  2026-Oct-17  Initial   0.0.0   ADCL  Initial version
+//
+//=================================================================================================================
+
+
+
+#include "ada.hh"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+
+
+//
+// -- The header of the image
+//    -----------------------
+using CacheHeader_t = struct CacheHeader_t {
+    char magic[8];                  // -- "ADATOKS" and a NUL
+    uint32_t format;                // -- the version of this layout
+    uint32_t tokens;                // -- the number of kinds and positions
+    uint64_t key;                   // -- the hash of the source and the build
+    uint64_t sourceSize;
+    uint32_t payloads;              // -- the number of payload records, including the empty one at 0
+    uint32_t atoms;                 // -- the number of identifier spellings
+    uint32_t atomBytes;             // -- the total length of the spellings
+    uint32_t literalWords;          // -- the number of words of literal values
+};
+
+
+static const char cacheMagic[8] = "ADATOKS";
+static const uint32_t cacheFormat = 1;
+
+
+
+//
+// -- A payload record.  `tag` is the index of the alternative in YYSTYPE:
+//    * a character literal has the offset in `a` and the value in `b`
+//    * a string literal has the offset, length and escaped flag in `a`, `b` and `c`
+//    * an identifier has the index of its spelling in `a`
+//    * a numeric literal has the word index of its value in `a` and `b` is set for a real
+//    -----------------------------------------------------------------------------------
+using CachedPayload_t = struct CachedPayload_t {
+    uint32_t tag;
+    uint32_t a;
+    uint32_t b;
+    uint32_t c;
+};
+
+
+
+//
+// -- Round a section size up to the 8-byte boundary
+//    ----------------------------------------------
+static inline size_t Pad(size_t n) { return (n + 7) & ~(size_t)7; }
+
+
+
+//
+// -- A BigInt is saved as a word holding its limb count and sign, followed by the limbs
+//    ----------------------------------------------------------------------------------
+static void PutBigInt(std::vector<uint32_t> &words, const BigInt &v)
+{
+    const std::vector<uint32_t> &limbs = v.Limbs();
+
+    words.push_back((uint32_t)(limbs.size() << 1) | (v.IsNegative() ? 1 : 0));
+    words.insert(words.end(), limbs.begin(), limbs.end());
+}
+
+
+static bool GetBigInt(const uint32_t *words, uint32_t count, uint32_t &at, BigInt &v)
+{
+    if (at >= count) return false;
+
+    uint32_t n = words[at] >> 1;
+    bool neg = words[at] & 1;
+
+    if (n > count - at - 1) return false;
+
+    v = BigInt(std::vector<uint32_t>(words + at + 1, words + at + 1 + n), neg);
+    at += n + 1;
+    return true;
+}
+
+
+
+//
+// -- The cache key is a 64-bit FNV-1a hash of the source text and of the compiler executable's size
+//    and modification time, so a rebuilt compiler never picks up images from an older one
+//    ---------------------------------------------------------------------------------------------
+uint64_t TokenCache::Key(const SourceFile &source)
+{
+    uint64_t h = 0xcbf29ce484222325ull;
+    auto mix = [&h](const void *data, size_t len) {
+        const unsigned char *p = static_cast<const unsigned char *>(data);
+        for (size_t i = 0; i < len; i ++) {
+            h ^= p[i];
+            h *= 0x100000001b3ull;
+        }
+    };
+
+    struct stat st;
+    uint64_t build[2] = { 0, 0 };
+
+    if (stat("/proc/self/exe", &st) == 0) {
+        build[0] = st.st_size;
+        build[1] = st.st_mtime;
+    }
+
+    mix(source.Buffer(), source.Size());
+    mix(build, sizeof(build));
+    mix(&cacheFormat, sizeof(cacheFormat));
+
+    return h;
+}
+
+
+
+//
+// -- The image for a key lives in the cache directory
+//    ------------------------------------------------
+std::string TokenCache::Path(const std::string &dir, uint64_t key)
+{
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.tok", (unsigned long long)key);
+
+    return dir + "/" + name;
+}
+
+
+
+//
+// -- Load the token stream from its image, if there is a good one.  The stream is left untouched when
+//    this returns false.
+//    ------------------------------------------------------------------------------------------------
+bool TokenCache::Load(TokenStream &ts, const std::string &dir)
+{
+    uint64_t key = Key(ts.source);
+    int fd = open(Path(dir, key).c_str(), O_RDONLY);
+    struct stat st;
+
+    if (fd < 0) return false;
+
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(CacheHeader_t)) {
+        close(fd);
+        return false;
+    }
+
+    size_t size = st.st_size;
+    void *map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (map == MAP_FAILED) return false;
+
+
+    //
+    // -- check the header and that the sections exactly fill the image
+    //    -------------------------------------------------------------
+    const char *img = static_cast<const char *>(map);
+    const CacheHeader_t *hdr = reinterpret_cast<const CacheHeader_t *>(img);
+
+    size_t kindsAt = Pad(sizeof(CacheHeader_t));
+    size_t positionsAt = kindsAt + Pad(hdr->tokens * sizeof(TokenType));
+    size_t payloadsAt = positionsAt + Pad(hdr->tokens * sizeof(TokenStream::TokenPos));
+    size_t offsetsAt = payloadsAt + Pad(hdr->payloads * sizeof(CachedPayload_t));
+    size_t textAt = offsetsAt + Pad((hdr->atoms + 1) * sizeof(uint32_t));
+    size_t wordsAt = textAt + Pad(hdr->atomBytes);
+    size_t endAt = wordsAt + Pad(hdr->literalWords * sizeof(uint32_t));
+
+    if (memcmp(hdr->magic, cacheMagic, sizeof(cacheMagic)) != 0 || hdr->format != cacheFormat
+            || hdr->key != key || hdr->sourceSize != ts.source.Size()
+            || hdr->tokens == 0 || hdr->payloads == 0 || endAt != size) {
+        munmap(map, size);
+        return false;
+    }
+
+    const TokenType *kinds = reinterpret_cast<const TokenType *>(img + kindsAt);
+    const TokenStream::TokenPos *positions = reinterpret_cast<const TokenStream::TokenPos *>(img + positionsAt);
+    const CachedPayload_t *recs = reinterpret_cast<const CachedPayload_t *>(img + payloadsAt);
+    const uint32_t *offsets = reinterpret_cast<const uint32_t *>(img + offsetsAt);
+    const char *text = img + textAt;
+    const uint32_t *words = reinterpret_cast<const uint32_t *>(img + wordsAt);
+
+
+    //
+    // -- rebuild the payloads, interning the spellings and pooling the literal values again
+    //    ----------------------------------------------------------------------------------
+    std::vector<Atom_t> atomMap(hdr->atoms);
+    std::vector<YYSTYPE> payloads(hdr->payloads);
+    bool ok = true;
+
+    for (uint32_t i = 0; ok && i < hdr->atoms; i ++) {
+        ok = offsets[i] <= offsets[i + 1] && offsets[i + 1] <= hdr->atomBytes;
+        if (ok) atomMap[i] = atoms.Intern(std::string_view(text + offsets[i], offsets[i + 1] - offsets[i]));
+    }
+
+    for (uint32_t i = 1; ok && i < hdr->payloads; i ++) {
+        const CachedPayload_t &rec = recs[i];
+        uint32_t at = rec.a;
+        BigInt num, den;
+
+        switch (rec.tag) {
+        case 1:
+            payloads[i] = CharLiteral { rec.a, (int)rec.b };
+            break;
+
+        case 2:
+            payloads[i] = StringLiteral { rec.a, rec.b, rec.c != 0 };
+            break;
+
+        case 3:
+            ok = rec.a < hdr->atoms;
+            if (ok) payloads[i] = IdentifierLexeme { atomMap[rec.a] };
+            break;
+
+        case 4:
+            ok = GetBigInt(words, hdr->literalWords, at, num);
+
+            if (ok && rec.b) {
+                ok = GetBigInt(words, hdr->literalWords, at, den) && !den.IsZero();
+                if (ok) payloads[i] = NumericLiteral { literals.AddReal(Rational(num, den)) };
+            } else if (ok) {
+                payloads[i] = NumericLiteral { literals.AddInteger(num) };
+            }
+
+            break;
+
+        default:
+            ok = false;
+            break;
+        }
+    }
+
+    if (ok) {
+        ts.kinds.assign(kinds, kinds + hdr->tokens);
+        ts.positions.assign(positions, positions + hdr->tokens);
+        ts.payloads = std::move(payloads);
+    }
+
+    munmap(map, size);
+    return ok;
+}
+
+
+
+//
+// -- Save the token stream as an image.  It is written to a temporary file which is then renamed into
+//    place, so a reader never sees a partial image.  Any failure simply leaves the cache without it.
+//    ------------------------------------------------------------------------------------------------
+void TokenCache::Save(const TokenStream &ts, const std::string &dir)
+{
+    std::vector<CachedPayload_t> recs(ts.payloads.size(), CachedPayload_t { 0, 0, 0, 0 });
+    std::unordered_map<Atom_t, uint32_t> localAtoms;
+    std::vector<uint32_t> offsets = { 0 };
+    std::string text;
+    std::vector<uint32_t> words;
+
+
+    //
+    // -- Walk the tokens to make the payload records, since a numeric literal needs its token to
+    //    tell which table of the literal pool it is in
+    //    ---------------------------------------------------------------------------------------
+    for (size_t i = 0; i < ts.kinds.size(); i ++) {
+        uint32_t idx = ts.positions[i].payload;
+        if (!idx) continue;
+
+        const YYSTYPE &payload = ts.payloads[idx];
+        CachedPayload_t &rec = recs[idx];
+
+        rec.tag = payload.index();
+
+        if (const CharLiteral *ch = std::get_if<CharLiteral>(&payload)) {
+            rec.a = ch->offset;
+            rec.b = (uint32_t)ch->value;
+        } else if (const StringLiteral *str = std::get_if<StringLiteral>(&payload)) {
+            rec.a = str->offset;
+            rec.b = str->length;
+            rec.c = str->escaped;
+        } else if (const IdentifierLexeme *id = std::get_if<IdentifierLexeme>(&payload)) {
+            auto it = localAtoms.find(id->name);
+
+            if (it == localAtoms.end()) {
+                it = localAtoms.emplace(id->name, offsets.size() - 1).first;
+                text += atoms.Spelling(id->name);
+                offsets.push_back(text.size());
+            }
+
+            rec.a = it->second;
+        } else if (const NumericLiteral *num = std::get_if<NumericLiteral>(&payload)) {
+            rec.a = words.size();
+
+            if (ts.kinds[i] == TokenType::TOK_UNIVERSAL_REAL_LITERAL) {
+                const Rational &v = literals.Real(num->index);
+                rec.b = 1;
+                PutBigInt(words, v.Numerator());
+                PutBigInt(words, v.Denominator());
+            } else {
+                PutBigInt(words, literals.Integer(num->index));
+            }
+        }
+    }
+
+
+    //
+    // -- now write it all out
+    //    --------------------
+    CacheHeader_t hdr = {};
+
+    memcpy(hdr.magic, cacheMagic, sizeof(cacheMagic));
+    hdr.format = cacheFormat;
+    hdr.tokens = ts.kinds.size();
+    hdr.key = Key(ts.source);
+    hdr.sourceSize = ts.source.Size();
+    hdr.payloads = recs.size();
+    hdr.atoms = offsets.size() - 1;
+    hdr.atomBytes = text.size();
+    hdr.literalWords = words.size();
+
+    mkdir(dir.c_str(), 0777);
+
+    std::string path = Path(dir, hdr.key);
+    std::string temp = path + ".tmp" + std::to_string(getpid());
+    FILE *fp = fopen(temp.c_str(), "wb");
+    if (!fp) return;
+
+    static const char zeros[8] = {};
+    bool ok = true;
+    auto put = [&](const void *data, size_t len) {
+        if (len) ok = ok && fwrite(data, 1, len, fp) == len;
+        ok = ok && fwrite(zeros, 1, Pad(len) - len, fp) == Pad(len) - len;
+    };
+
+    put(&hdr, sizeof(hdr));
+    put(ts.kinds.data(), ts.kinds.size() * sizeof(TokenType));
+    put(ts.positions.data(), ts.positions.size() * sizeof(TokenStream::TokenPos));
+    put(recs.data(), recs.size() * sizeof(CachedPayload_t));
+    put(offsets.data(), offsets.size() * sizeof(uint32_t));
+    put(text.data(), text.size());
+    put(words.data(), words.size() * sizeof(uint32_t));
+
+    ok = (fclose(fp) == 0) && ok;
+
+    if (!ok || rename(temp.c_str(), path.c_str()) != 0) unlink(temp.c_str());
+}
+
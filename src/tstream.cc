@@ -15,86 +15,567 @@
 
 #include "ada.hh"
 
+#include <algorithm>
+
 
 
 //
-// -- This is used by the scanner to save additional info for a token
-//    ---------------------------------------------------------------
-int column = 1;
+// -- The ranges of source location handles given to the token streams, in the order they were given.
+//    A stream which is gone leaves its range behind with no stream, and handles are never reused.
+//    -------------------------------------------------------------------------------------------------
+using HandleRange_t = struct HandleRange_t {
+    uint32_t base;
+    uint32_t count;
+    TokenStream *stream;
+};
+
+static std::vector<HandleRange_t> handleRanges;
+static uint32_t nextHandle = 1;
 
 
 
 //
 // -- Construct the token stream.  This is done by scanning the entire file and
-//    turning each token into an element in the vector table.
-//    -------------------------------------------------------------------------
-TokenStream::TokenStream(const char *fn) : filename(fn?fn:"stdin"), loc(0)
+//    turning each token into an element in the token arrays.  The lexer works
+//    directly from the source buffer, so the file is only ever read once.  A big
+//    file is cut into chunks which are lexed at the same time.  When streaming,
+//    nothing is lexed here at all.
+//    ----------------------------------------------------------------------------
+TokenStream::TokenStream(const char *fn)
+        : loc(0), first(0), filename(fn?fn:"stdin"), source(fn), streaming(opts.streamTokens), held(false)
 {
-    extern TokenType yylex(void);
-    extern FILE *yyin;
-    extern YYSTYPE yylval;
-    extern int yylineno;
-
-    yyin = nullptr;
-    yylineno = 0;           // set to 0 to make everything happy!
-    column = 1;
-
-    if (fn) yyin = fopen(fn, "r");
-
-    if (!yyin) {
-        std::cerr << "Unable to open file; using stdin.\n";
-        std::cerr << "   Ctrl-c to stop; Ctrl-d for EOF\n";
-        yyin = stdin;
-        sourceValid = false;
-    } else {
-        static char buf[2048];
-        while (fgets(buf, 2048, yyin)) {
-            source.push_back(std::string(buf));
-        }
+    Register();
+
+    Lexer::Kind kind = opts.fastLexer ? Lexer::Kind::Fast : Lexer::Kind::Flex;
+    unsigned jobs = opts.lexJobs ? opts.lexJobs : std::thread::hardware_concurrency();
+
+    if (streaming) {
+        lexer = Lexer::Create(kind, source);
+        payloads.push_back(std::monostate {});
+        Reset(0);
+        return;
+    }
 
-        fseek(yyin, 0, SEEK_SET);
-        sourceValid = true;
+
+    //
+    // -- a cached image of the tokens saves lexing the source at all
+    //    -----------------------------------------------------------
+    if (!opts.tokenCache.empty() && TokenCache::Load(*this, opts.tokenCache)) {
+        Reset(0);
+        return;
     }
 
-    TokenType tok = (TokenType)yylex();
+
+    //
+    // -- a rough guess at the number of tokens keeps the arrays from being copied as they grow
+    //    -------------------------------------------------------------------------------------
+    kinds.reserve(source.Size() / 5 + 16);
+    positions.reserve(source.Size() / 5 + 16);
+    payloads.push_back(std::monostate {});
+
+    if (jobs > 1 && source.Size() >= opts.chunkedLexSize) LexChunked(kind, jobs);
+    else Lex(kind);
+
+
+    //
+    // -- add an EOF marker so that we can query it; there is no payload
+    //    --------------------------------------------------------------
+    TokenPos eof = { (uint32_t)source.Size(), (uint32_t)source.LineCount(), 0, 0 };
+    Append(TokenType::YYEOF, eof, payloads[0]);
+
+    if (!opts.tokenCache.empty()) TokenCache::Save(*this, opts.tokenCache);
+
+    Reset(0);
+}
+
+
+
+//
+// -- Lex the whole source in one go
+//    ------------------------------
+void TokenStream::Lex(Lexer::Kind kind)
+{
+    std::unique_ptr<Lexer> lexer = Lexer::Create(kind, source);
+
+
+    //
+    // -- `and then` and `or else` are fused into a single token here; when the
+    //    second token is not a match, it is processed in its own right.
+    //    ---------------------------------------------------------------------
+    TokenType tok = lexer->Next();
     while ((int)tok) {
-        int l = yylineno;
-        int c = column;
-        YYSTYPE v = yylval;
+        TokenPos pos = { lexer->Offset(), lexer->Line(), lexer->Column(), 0 };
 
-        if (tok == TokenType::TOK_AND) {
-            TokenType tok2 = (TokenType)yylex();
+        if (tok == TokenType::TOK_AND || tok == TokenType::TOK_OR) {
+            TokenType tok2 = lexer->Next();
 
-            if (tok2 == TokenType::TOK_THEN) {
-                tokStream.push_back(new Token(filename, l, c, TokenType::TOK_AND_THEN, v));
+            if (tok == TokenType::TOK_AND && tok2 == TokenType::TOK_THEN) {
+                Append(TokenType::TOK_AND_THEN, pos, lexer->Payload());
+                tok = lexer->Next();
+            } else if (tok == TokenType::TOK_OR && tok2 == TokenType::TOK_ELSE) {
+                Append(TokenType::TOK_OR_ELSE, pos, lexer->Payload());
+                tok = lexer->Next();
             } else {
-                tokStream.push_back(new Token(filename, l, c, tok, v));
-                tokStream.push_back(new Token(filename, l, c, tok2, v));
+                Append(tok, pos, lexer->Payload());
+                tok = tok2;
             }
-        } else if (tok == TokenType::TOK_OR) {
-            TokenType tok2 = (TokenType)yylex();
 
-            if (tok2 == TokenType::TOK_ELSE) {
-                tokStream.push_back(new Token(filename, l, c, TokenType::TOK_OR_ELSE, v));
-            } else {
-                tokStream.push_back(new Token(filename, l, c, tok, v));
-                tokStream.push_back(new Token(filename, l, c, tok2, v));
+            continue;
+        }
+
+        Append(tok, pos, lexer->Payload());
+        tok = lexer->Next();
+    }
+}
+
+
+
+//
+// -- Lex the source in chunks on several threads.  No lexeme can span a line feed, so the source
+//    is cut just after line feeds and each window is lexed on its own.  The windows are then
+//    joined back up in order.
+//    ---------------------------------------------------------------------------------------------
+void TokenStream::LexChunked(Lexer::Kind kind, unsigned jobs)
+{
+    const char *text = source.Buffer();
+    size_t size = source.Size();
+    std::vector<Chunk_t> chunks;
+
+
+    //
+    // -- cut the source into windows of about the same size; a carriage return right after the line
+    //    feed stays in the window, since flex matches `\n\r` as a single line break
+    //    ---------------------------------------------------------------------------------------------
+    for (size_t from = 0, i = 1; from < size; i ++) {
+        size_t to = size;
+
+        if (i < jobs) {
+            size_t cut = std::max(from, size / jobs * i);
+            const char *lf = (const char *)memchr(text + cut, '\n', size - cut);
+
+            if (lf) {
+                to = lf - text + 1;
+                if (to < size && text[to] == '\r') to ++;
+            }
+        }
+
+        chunks.push_back({ (uint32_t)from, (uint32_t)to, {}, {}, {}, 0, true });
+        from = to;
+    }
+
+
+    //
+    // -- lex each window on its own thread; this thread takes the first one
+    //    ------------------------------------------------------------------
+    std::vector<std::thread> threads;
+
+    for (size_t i = 1; i < chunks.size(); i ++) {
+        threads.emplace_back(LexChunk, kind, std::cref(source), std::ref(chunks[i]));
+    }
+
+    if (!chunks.empty()) LexChunk(kind, source, chunks[0]);
+    for (std::thread &t : threads) t.join();
+
+
+    //
+    // -- a window which did not end at a boundary (pragma arguments continued on the next line, or a
+    //    string ended in error by the line break) leaves the next window lexed from the wrong state,
+    //    so the 2 are joined and lexed again
+    //    ---------------------------------------------------------------------------------------------
+    for (size_t i = 0; i + 1 < chunks.size(); ) {
+        if (chunks[i].boundary) {
+            i ++;
+            continue;
+        }
+
+        chunks[i].to = chunks[i + 1].to;
+        chunks.erase(chunks.begin() + i + 1);
+        LexChunk(kind, source, chunks[i]);
+    }
+
+
+    //
+    // -- now join the windows, moving the lines along and fusing `and then` and `or else`, which
+    //    may well have been split across 2 windows
+    //    ---------------------------------------------------------------------------------------
+    uint32_t lines = 0;
+
+    for (const Chunk_t &chunk : chunks) {
+        for (size_t i = 0; i < chunk.kinds.size(); i ++) {
+            TokenType tok = chunk.kinds[i];
+            TokenPos pos = chunk.positions[i];
+
+            if (!kinds.empty()) {
+                if (tok == TokenType::TOK_THEN && kinds.back() == TokenType::TOK_AND) {
+                    kinds.back() = TokenType::TOK_AND_THEN;
+                    continue;
+                }
+
+                if (tok == TokenType::TOK_ELSE && kinds.back() == TokenType::TOK_OR) {
+                    kinds.back() = TokenType::TOK_OR_ELSE;
+                    continue;
+                }
+            }
+
+            pos.line += lines;
+            Append(tok, pos, HasPayload(tok) ? chunk.payloads[pos.payload] : payloads[0]);
+        }
+
+        lines += chunk.lines;
+    }
+}
+
+
+
+//
+// -- Lex one window of the source into its chunk
+//    -------------------------------------------
+void TokenStream::LexChunk(Lexer::Kind kind, const SourceFile &source, Chunk_t &chunk)
+{
+    std::unique_ptr<Lexer> lexer = Lexer::Create(kind, source, chunk.from, chunk.to);
+
+    chunk.kinds.clear();
+    chunk.positions.clear();
+    chunk.payloads.clear();
+    chunk.kinds.reserve((chunk.to - chunk.from) / 5 + 16);
+    chunk.positions.reserve((chunk.to - chunk.from) / 5 + 16);
+
+    for (TokenType tok = lexer->Next(); (int)tok; tok = lexer->Next()) {
+        TokenPos pos = { lexer->Offset(), lexer->Line(), lexer->Column(), 0 };
+
+        if (HasPayload(tok)) {
+            pos.payload = chunk.payloads.size();
+            chunk.payloads.push_back(lexer->Payload());
+        }
+
+        chunk.kinds.push_back(tok);
+        chunk.positions.push_back(pos);
+    }
+
+    chunk.lines = lexer->Line();
+    chunk.boundary = lexer->AtBoundary();
+}
+
+
+
+//
+// -- Can the lexer be in any state but the initial one after this token?  It can after a pragma and
+//    through the pragma arguments (which may run on over lines), and after an error (which leaves the
+//    column off by one for the rest of the line).  Also, `and` and `or` may yet be fused with the
+//    token which follows, and a fused `and then` or `or else` may run on into the next line.  After
+//    any other token, the lexer is at a boundary at the next line.
+//    -------------------------------------------------------------------------------------------------
+bool TokenStream::Settled(TokenType tok)
+{
+    switch (tok) {
+    case TokenType::TOK_PRAGMA:
+    case TokenType::TOK_PRAGMA_NAME:
+    case TokenType::TOK_IDENTIFIER:
+    case TokenType::TOK_LEFT_PARENTHESIS:
+    case TokenType::TOK_COMMA:
+    case TokenType::TOK_ARROW:
+    case TokenType::TOK_ERROR:
+    case TokenType::TOK_AND:
+    case TokenType::TOK_OR:
+    case TokenType::TOK_AND_THEN:
+    case TokenType::TOK_OR_ELSE:
+        return false;
+
+    default:
+        return true;
+    }
+}
+
+
+
+//
+// -- Replace `removed` bytes of the source at `offset` with `text` and lex again only the lines which
+//    changed.  Lexing starts at the line before the edit and carries on past it until the lexer is at
+//    a line boundary where the old stream was also at one; from there, the old tokens are the same as
+//    the new ones but for their positions, which are moved along.  Lines ending in a token which is
+//    not settled are lexed again along with those they run on into.
+//    -------------------------------------------------------------------------------------------------
+TokenEdit_t TokenStream::Edit(uint32_t offset, uint32_t removed, std::string_view text)
+{
+    assert(!streaming);
+    assert(offset + removed <= source.Size());
+
+    Lexer::Kind kind = opts.fastLexer ? Lexer::Kind::Fast : Lexer::Kind::Flex;
+    const char *buf = source.Buffer();
+
+
+    //
+    // -- the start of the line holding `x`, after its line feed and any carriage return paired with it
+    //    ---------------------------------------------------------------------------------------------
+    auto lineStart = [&buf](uint32_t x) {
+        uint32_t from = x;
+
+        while (from > 0 && buf[from - 1] != '\n') from --;
+        if (from < x && buf[from] == '\r') from ++;
+
+        return from;
+    };
+
+    auto tokenAt = [this](uint32_t at) {
+        return (int)(std::lower_bound(positions.begin(), positions.end(), at,
+                [](const TokenPos &pos, uint32_t o) { return pos.offset < o; }) - positions.begin());
+    };
+
+
+    //
+    // -- find where to start lexing: the line before the edit, or earlier while the line before ends
+    //    unsettled
+    //    -------------------------------------------------------------------------------------------
+    uint32_t from = lineStart(offset ? offset - 1 : 0);
+    int start = tokenAt(from);
+
+    while (start > 0 && !Settled(kinds[start - 1])) {
+        from = lineStart(positions[start - 1].offset);
+        start = tokenAt(from);
+    }
+
+    uint32_t fromLine = source.LineOf(from);
+    int lines = std::count(text.begin(), text.end(), '\n') - std::count(buf + offset, buf + offset + removed, '\n');
+    int64_t delta = (int64_t)text.size() - removed;
+
+    source.Replace(offset, removed, text);
+    buf = source.Buffer();
+    if (source.Size() >= handles) Register();
+
+
+    //
+    // -- lex from there to the line break after the edit, and on a line at a time until both the old
+    //    and new streams are settled there
+    //    ---------------------------------------------------------------------------------------------
+    size_t size = source.Size();
+    uint32_t cut = offset + text.size();
+    int stop;
+    Chunk_t chunk;
+
+    for (;;) {
+        const char *lf = (const char *)memchr(buf + cut, '\n', size - cut);
+
+        if (lf) {
+            cut = lf - buf + 1;
+            if (cut < size && buf[cut] == '\r') cut ++;
+        } else {
+            cut = size;
+        }
+
+        chunk = { from, cut, {}, {}, {}, 0, true };
+        LexChunk(kind, source, chunk);
+
+        if (cut == size) {
+            stop = kinds.size() - 1;
+            break;
+        }
+
+        stop = tokenAt(cut - delta);
+
+        bool newSettled = chunk.boundary
+                && (chunk.kinds.empty() ? start == 0 || Settled(kinds[start - 1]) : Settled(chunk.kinds.back()));
+
+        if (newSettled && (stop == 0 || Settled(kinds[stop - 1]))) break;
+    }
+
+
+    //
+    // -- build the new tokens, fusing `and then` and `or else`
+    //    -----------------------------------------------------
+    std::vector<TokenType> newKinds;
+    std::vector<TokenPos> newPositions;
+
+    for (size_t i = 0; i < chunk.kinds.size(); i ++) {
+        TokenType tok = chunk.kinds[i];
+        TokenPos pos = chunk.positions[i];
+
+        if (!newKinds.empty()) {
+            if (tok == TokenType::TOK_THEN && newKinds.back() == TokenType::TOK_AND) {
+                newKinds.back() = TokenType::TOK_AND_THEN;
+                continue;
+            }
+
+            if (tok == TokenType::TOK_ELSE && newKinds.back() == TokenType::TOK_OR) {
+                newKinds.back() = TokenType::TOK_OR_ELSE;
+                continue;
             }
+        }
+
+        pos.line += fromLine;
+
+        if (HasPayload(tok)) {
+            payloads.push_back(chunk.payloads[pos.payload]);
+            pos.payload = payloads.size() - 1;
+        }
+
+        newKinds.push_back(tok);
+        newPositions.push_back(pos);
+    }
+
+
+    //
+    // -- move the tokens after the edit along, and then splice in the new ones; the tokens which
+    //    replace old ones are copied over them, so the tail is only moved when the count changes
+    //    ---------------------------------------------------------------------------------------
+    for (size_t i = stop; i < kinds.size(); i ++) {
+        TokenPos &pos = positions[i];
+
+        pos.offset += delta;
+        pos.line += lines;
+
+        if (!pos.payload) continue;
+
+        if (CharLiteral *ch = std::get_if<CharLiteral>(&payloads[pos.payload])) ch->offset += delta;
+        else if (StringLiteral *str = std::get_if<StringLiteral>(&payloads[pos.payload])) str->offset += delta;
+    }
+
+    size_t common = std::min((size_t)(stop - start), newKinds.size());
+
+    std::copy(newKinds.begin(), newKinds.begin() + common, kinds.begin() + start);
+    std::copy(newPositions.begin(), newPositions.begin() + common, positions.begin() + start);
+
+    if (newKinds.size() > common) {
+        kinds.insert(kinds.begin() + start + common, newKinds.begin() + common, newKinds.end());
+        positions.insert(positions.begin() + start + common, newPositions.begin() + common, newPositions.end());
+    } else {
+        kinds.erase(kinds.begin() + start + common, kinds.begin() + stop);
+        positions.erase(positions.begin() + start + common, positions.begin() + stop);
+    }
+
+    positions.back() = { (uint32_t)size, (uint32_t)source.LineCount(), 0, 0 };
+
+    TokenEdit_t rv = { start, stop - start, (int)newKinds.size() };
+
+    if (loc >= stop) loc += rv.inserted - rv.removed;
+    else if (loc > start) loc = start;
+
+    return rv;
+}
+
+
+
+//
+// -- Lex more of a streamed source, until the token at location `n` is in the arrays.  Once the EOF
+//    has been lexed, any further lookahead simply sees more EOF tokens.
+//    ------------------------------------------------------------------------------------------------
+void TokenStream::Fill(int n)
+{
+    if (!streaming) return;
+
+    Release();
+
+    while (n - first >= (int)kinds.size()) {
+        if (lexer) LexOne();
+        else Append(TokenType::YYEOF, positions.back(), payloads[0]);
+    }
+}
+
+
+
+//
+// -- Lex the next token of a streamed source, fusing `and then` and `or else` as `Lex()` does.  The
+//    token after an `and` or `or` which does not fuse is held until the next call.
+//    -----------------------------------------------------------------------------------------------
+void TokenStream::LexOne(void)
+{
+    TokenType tok;
+    TokenPos pos;
+
+    if (held) {
+        tok = heldTok;
+        pos = heldPos;
+        held = false;
+
+        if (tok != TokenType::YYEOF && tok != TokenType::TOK_AND && tok != TokenType::TOK_OR) {
+            Append(tok, pos, heldPayload);
+            return;
+        }
+    } else {
+        tok = lexer->Next();
+        pos = { lexer->Offset(), lexer->Line(), lexer->Column(), 0 };
+    }
+
+    if (!(int)tok) {
+        TokenPos eof = { (uint32_t)source.Size(), (uint32_t)source.LineCount(), 0, 0 };
+        Append(TokenType::YYEOF, eof, payloads[0]);
+        lexer.reset();
+        return;
+    }
+
+    if (tok == TokenType::TOK_AND || tok == TokenType::TOK_OR) {
+        TokenType tok2 = lexer->Next();
+
+        if (tok == TokenType::TOK_AND && tok2 == TokenType::TOK_THEN) {
+            Append(TokenType::TOK_AND_THEN, pos, payloads[0]);
+        } else if (tok == TokenType::TOK_OR && tok2 == TokenType::TOK_ELSE) {
+            Append(TokenType::TOK_OR_ELSE, pos, payloads[0]);
         } else {
-            tokStream.push_back(new Token(filename, l, c, tok, v));
+            Append(tok, pos, payloads[0]);
+
+            held = true;
+            heldTok = tok2;
+            heldPos = { lexer->Offset(), lexer->Line(), lexer->Column(), 0 };
+            heldPayload = HasPayload(tok2) ? lexer->Payload() : YYSTYPE {};
         }
 
-        tok = (TokenType)yylex();
+        return;
     }
 
+    Append(tok, pos, lexer->Payload());
+}
+
+
+
+//
+// -- Drop the tokens which nothing can get back to: those before both the current location and the
+//    oldest live mark.  They are only dropped once they outnumber the tokens being kept, so the cost
+//    of moving the kept tokens to the front is spread over the tokens dropped.
+//    -----------------------------------------------------------------------------------------------
+void TokenStream::Release(void)
+{
+    int keep = marks.empty() ? loc : std::min(loc, marks.front());
+    size_t dead = std::min((size_t)(keep - first), kinds.size());
+
+    if (dead < 4096 || dead < kinds.size() - dead) return;
+
+    kinds.erase(kinds.begin(), kinds.begin() + dead);
+    positions.erase(positions.begin(), positions.begin() + dead);
+    first += dead;
+
 
     //
-    // -- add an EOF marker so that we can query it; yylval is irrelevant
-    //    ---------------------------------------------------------------
-    tokStream.push_back(new Token(filename, source.size(), 0, TokenType::YYEOF, yylval));
+    // -- the payloads go in the same order as the tokens, so those before the first one still
+    //    referenced are dropped as well (keeping the empty payload at 0)
+    //    -------------------------------------------------------------------------------------
+    uint32_t from = payloads.size();
+
+    for (const TokenPos &pos : positions) {
+        if (pos.payload) {
+            from = pos.payload;
+            break;
+        }
+    }
 
-    fclose(yyin);
-    Reset(0);
+    if (from > 1) {
+        payloads.erase(payloads.begin() + 1, payloads.begin() + from);
+        for (TokenPos &pos : positions) if (pos.payload) pos.payload -= from - 1;
+    }
+}
+
+
+
+//
+// -- Add a token to the end of the stream, keeping the payload only for those tokens which carry one
+//    -----------------------------------------------------------------------------------------------
+void TokenStream::Append(TokenType tok, const TokenPos &pos, const YYSTYPE &payload)
+{
+    kinds.push_back(tok);
+    positions.push_back(pos);
+
+    if (HasPayload(tok)) {
+        positions.back().payload = payloads.size();
+        payloads.push_back(payload);
+    }
 }
 
 
@@ -246,8 +727,8 @@ void TokenStream::Listing(void)
     std::cout << "Listing for " << filename << ":\n";
     std::cout << std::string(line).substr(0, filename.length() + 13) << '\n';
 
-    for (int i = 0; i < source.size(); i ++) {
-        std::cout << std::setw(6) << i + 1 << "   " << source[i];
+    for (size_t i = 0; i < source.LineCount(); i ++) {
+        std::cout << std::setw(6) << i + 1 << "   " << source.Line(i) << '\n';
     }
 
     std::cout << "\n\n";
@@ -279,17 +760,20 @@ void TokenStream::List(void)
 
 
 //
-// -- Get the source location for diagnostic messages
-//    -----------------------------------------------
-SourceLoc_t TokenStream::SourceLocation(void)
+// -- Get the value of a string literal from its source text, collapsing doubled quotes.  The text is
+//    only copied when the value is actually wanted.
+//    ------------------------------------------------------------------------------------------------
+std::string TokenStream::StringValue(std::string_view text, bool escaped)
 {
-    SourceLoc_t rv;
+    if (!escaped) return std::string(text);
 
-    rv.filename = filename;
-    rv.line = tokStream[loc]->yylineno + 1;
-    rv.col = tokStream[loc]->column - 1;
-    rv.sourceLine = (tokStream[loc]->yylineno < source.size()) ? source[tokStream[loc]->yylineno] : "";
-    rv.valid = !rv.sourceLine.empty();
+    std::string rv;
+    rv.reserve(text.size());
+
+    for (size_t i = 0; i < text.size(); i ++) {
+        rv.push_back(text[i]);
+        if (text[i] == '"') i ++;
+    }
 
     return rv;
 }
@@ -297,17 +781,78 @@ SourceLoc_t TokenStream::SourceLocation(void)
 
 
 //
-// -- Get an empty source location
-//    ----------------------------
-SourceLoc_t TokenStream::EmptyLocation(void)
+// -- The stream is gone, so the handles in its range no longer expand to anything
+//    ----------------------------------------------------------------------------
+TokenStream::~TokenStream()
 {
-    SourceLoc_t rv;
+    for (HandleRange_t &range : handleRanges) {
+        if (range.stream == this) range.stream = nullptr;
+    }
+}
+
+
+
+//
+// -- Give the stream a range of source location handles big enough for its source and the EOF just
+//    past its end.  An edit which grows the source past its range moves it to a new one.
+//    ----------------------------------------------------------------------------------------------
+void TokenStream::Register(void)
+{
+    for (HandleRange_t &range : handleRanges) {
+        if (range.stream == this) range.stream = nullptr;
+    }
 
-    rv.filename = "";
-    rv.line = 0;
-    rv.col = 0;
-    rv.sourceLine = "";
-    rv.valid = false;
+    handles = source.Size() + 1;
+    assert(handles <= UINT32_MAX - nextHandle);
+
+    base = nextHandle;
+    nextHandle += handles;
+    handleRanges.push_back({ base, handles, this });
+}
+
+
+
+//
+// -- Expand a source location handle for a diagnostic message
+//    --------------------------------------------------------
+ExpandedLoc_t TokenStream::Expand(SourceLoc_t where)
+{
+    auto it = std::upper_bound(handleRanges.begin(), handleRanges.end(), where.handle,
+            [](uint32_t h, const HandleRange_t &range) { return h < range.base; });
+
+    if (where.handle == 0 || it == handleRanges.begin()) return { "", 0, 0, "", false };
+
+    -- it;
+    if (!it->stream || where.handle - it->base >= it->count) return { "", 0, 0, "", false };
+
+    return it->stream->ExpandOffset(where.handle - it->base);
+}
+
+
+
+//
+// -- Expand the location of the token at an offset.  The line and column are those the scanner gave
+//    the token; once a streamed token has been dropped, they are worked out again from the source and
+//    the column is then that of the start of the token.
+//    ------------------------------------------------------------------------------------------------
+ExpandedLoc_t TokenStream::ExpandOffset(uint32_t offset) const
+{
+    ExpandedLoc_t rv = { filename, 0, 0, "", false };
+    auto it = std::lower_bound(positions.begin(), positions.end(), offset,
+            [](const TokenPos &pos, uint32_t o) { return pos.offset < o; });
+    size_t line;
+
+    if (it != positions.end() && it->offset == offset) {
+        line = it->line;
+        rv.col = it->column - 1;
+    } else {
+        line = source.LineOf(offset);
+        if (line < source.LineCount()) rv.col = offset - (source.Line(line).data() - source.Buffer()) + 1;
+    }
+
+    rv.line = line + 1;
+    rv.sourceLine = std::string(source.Line(line));
+    rv.valid = !rv.sourceLine.empty();
 
     return rv;
 }
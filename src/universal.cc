@@ -0,0 +1,540 @@
+//=================================================================================================================
+//  universal.cc -- Implementation of the universal numeric types and the literal pool
+//
+//        Copyright (c)  2025-2026 -- Adam Clark; See LICENSE.md
+//
+// ---------------------------------------------------------------------------------------------------------------
+//
+//     Date      Tracker  Version  Pgmr  Description
+//  -----------  -------  -------  ----  -------------------------------------------------------------------------
+//  2026-Oct-17  Initial   0.0.0   ADCL  Initial version
+//
+//=================================================================================================================
+
+
+
+#include "ada.hh"
+
+
+
+//
+// -- This is the global literal pool for the compilation
+//    ---------------------------------------------------
+LiteralPool literals;
+
+
+
+//
+// -- Construct a BigInt from a native integer
+//    ----------------------------------------
+BigInt::BigInt(int64_t v)
+{
+    uint64_t m = v < 0 ? (uint64_t)0 - (uint64_t)v : (uint64_t)v;
+
+    while (m) {
+        mag.push_back((uint32_t)m);
+        m >>= 32;
+    }
+
+    neg = v < 0;
+}
+
+
+
+//
+// -- Remove any leading zero limbs and make sure zero is never negative
+//    ------------------------------------------------------------------
+void BigInt::Trim(void)
+{
+    while (!mag.empty() && mag.back() == 0) mag.pop_back();
+    if (mag.empty()) neg = false;
+}
+
+
+
+//
+// -- Compare the magnitudes of 2 BigInts
+//    -----------------------------------
+int BigInt::CompareMag(const BigInt &a, const BigInt &b)
+{
+    if (a.mag.size() != b.mag.size()) return a.mag.size() < b.mag.size() ? -1 : 1;
+
+    for (size_t i = a.mag.size(); i > 0; i --) {
+        if (a.mag[i - 1] != b.mag[i - 1]) return a.mag[i - 1] < b.mag[i - 1] ? -1 : 1;
+    }
+
+    return 0;
+}
+
+
+
+//
+// -- Compare 2 signed BigInts
+//    ------------------------
+int BigInt::Compare(const BigInt &a, const BigInt &b)
+{
+    if (a.neg != b.neg) return a.neg ? -1 : 1;
+
+    int c = CompareMag(a, b);
+    return a.neg ? -c : c;
+}
+
+
+
+//
+// -- Add the magnitudes of 2 BigInts; `r` may alias either operand
+//    -------------------------------------------------------------
+void BigInt::AddMag(BigInt &r, const BigInt &a, const BigInt &b)
+{
+    const std::vector<uint32_t> &x = a.mag.size() >= b.mag.size() ? a.mag : b.mag;
+    const std::vector<uint32_t> &y = a.mag.size() >= b.mag.size() ? b.mag : a.mag;
+    std::vector<uint32_t> out(x.size() + 1);
+    uint64_t carry = 0;
+
+    for (size_t i = 0; i < x.size(); i ++) {
+        carry += (uint64_t)x[i] + (i < y.size() ? y[i] : 0);
+        out[i] = (uint32_t)carry;
+        carry >>= 32;
+    }
+
+    out[x.size()] = (uint32_t)carry;
+    r.mag.swap(out);
+}
+
+
+
+//
+// -- Subtract the magnitude of `b` from the magnitude of `a`; `r` may alias either operand
+//    -------------------------------------------------------------------------------------
+void BigInt::SubMag(BigInt &r, const BigInt &a, const BigInt &b)
+{
+    std::vector<uint32_t> out(a.mag.size());
+    int64_t borrow = 0;
+
+    for (size_t i = 0; i < a.mag.size(); i ++) {
+        int64_t d = (int64_t)a.mag[i] - (i < b.mag.size() ? b.mag[i] : 0) - borrow;
+        borrow = d < 0;
+        out[i] = (uint32_t)(d + (borrow << 32));
+    }
+
+    r.mag.swap(out);
+}
+
+
+
+//
+// -- Addition and subtraction work on the magnitudes, choosing the operation by the signs
+//    ------------------------------------------------------------------------------------
+BigInt operator+(const BigInt &a, const BigInt &b)
+{
+    BigInt r;
+
+    if (a.neg == b.neg) {
+        BigInt::AddMag(r, a, b);
+        r.neg = a.neg;
+    } else if (BigInt::CompareMag(a, b) >= 0) {
+        BigInt::SubMag(r, a, b);
+        r.neg = a.neg;
+    } else {
+        BigInt::SubMag(r, b, a);
+        r.neg = b.neg;
+    }
+
+    r.Trim();
+    return r;
+}
+
+
+BigInt operator-(const BigInt &a, const BigInt &b)
+{
+    return a + (-b);
+}
+
+
+
+//
+// -- Schoolbook multiplication; literal values are small enough that nothing cleverer pays off
+//    -----------------------------------------------------------------------------------------
+BigInt operator*(const BigInt &a, const BigInt &b)
+{
+    BigInt r;
+    if (a.IsZero() || b.IsZero()) return r;
+
+    r.mag.assign(a.mag.size() + b.mag.size(), 0);
+
+    for (size_t i = 0; i < a.mag.size(); i ++) {
+        uint64_t carry = 0;
+
+        for (size_t j = 0; j < b.mag.size(); j ++) {
+            carry += (uint64_t)a.mag[i] * b.mag[j] + r.mag[i + j];
+            r.mag[i + j] = (uint32_t)carry;
+            carry >>= 32;
+        }
+
+        r.mag[i + b.mag.size()] = (uint32_t)carry;
+    }
+
+    r.neg = a.neg != b.neg;
+    r.Trim();
+    return r;
+}
+
+
+
+//
+// -- Multiply the magnitude by a small value in place
+//    ------------------------------------------------
+void BigInt::MulSmall(uint32_t m)
+{
+    uint64_t carry = 0;
+
+    for (auto &limb : mag) {
+        carry += (uint64_t)limb * m;
+        limb = (uint32_t)carry;
+        carry >>= 32;
+    }
+
+    if (carry) mag.push_back((uint32_t)carry);
+    Trim();
+}
+
+
+
+//
+// -- Add a small value to the magnitude in place
+//    -------------------------------------------
+void BigInt::AddSmall(uint32_t a)
+{
+    uint64_t carry = a;
+
+    for (size_t i = 0; carry && i < mag.size(); i ++) {
+        carry += mag[i];
+        mag[i] = (uint32_t)carry;
+        carry >>= 32;
+    }
+
+    if (carry) mag.push_back((uint32_t)carry);
+}
+
+
+
+//
+// -- Divide the magnitude by a small value in place, returning the remainder
+//    -----------------------------------------------------------------------
+uint32_t BigInt::DivSmall(uint32_t d)
+{
+    uint64_t rem = 0;
+
+    for (size_t i = mag.size(); i > 0; i --) {
+        uint64_t cur = (rem << 32) | mag[i - 1];
+        mag[i - 1] = (uint32_t)(cur / d);
+        rem = cur % d;
+    }
+
+    Trim();
+    return (uint32_t)rem;
+}
+
+
+
+//
+// -- Truncating division (the quotient rounds toward zero and the remainder takes the sign of `a`, as
+//    Ada `/` and `rem` do).  Single-limb divisors are the common case; anything else is done by a
+//    binary shift-and-subtract which is plenty for the sizes of static expressions.
+//    ------------------------------------------------------------------------------------------------
+void BigInt::DivMod(const BigInt &a, const BigInt &b, BigInt &q, BigInt &r)
+{
+    assert(!b.IsZero());
+
+    if (CompareMag(a, b) < 0) {
+        q = BigInt();
+        r = a;
+        return;
+    }
+
+    if (b.mag.size() == 1) {
+        q = a;
+        uint32_t rem = q.DivSmall(b.mag[0]);
+        q.neg = !q.IsZero() && (a.neg != b.neg);
+        r = BigInt((int64_t)rem);
+        if (a.neg) r = -r;
+        return;
+    }
+
+    BigInt d = b.Abs();
+    BigInt rem;
+    std::vector<uint32_t> quot(a.mag.size(), 0);
+
+    for (size_t i = a.mag.size() * 32; i > 0; i --) {
+        size_t bit = i - 1;
+
+        rem.MulSmall(2);
+        if ((a.mag[bit / 32] >> (bit % 32)) & 1) rem.AddSmall(1);
+
+        if (CompareMag(rem, d) >= 0) {
+            SubMag(rem, rem, d);
+            rem.Trim();
+            quot[bit / 32] |= 1u << (bit % 32);
+        }
+    }
+
+    q.mag.swap(quot);
+    q.neg = a.neg != b.neg;
+    q.Trim();
+
+    rem.neg = a.neg;
+    rem.Trim();
+    r = rem;
+}
+
+
+
+//
+// -- The greatest common divisor of the magnitudes
+//    ---------------------------------------------
+BigInt BigInt::Gcd(BigInt a, BigInt b)
+{
+    a = a.Abs();
+    b = b.Abs();
+
+    while (!b.IsZero()) {
+        BigInt t = a % b;
+        a = b;
+        b = t;
+    }
+
+    return a;
+}
+
+
+
+//
+// -- Raise a small base to a power
+//    -----------------------------
+BigInt BigInt::Pow(uint32_t base, uint32_t exp)
+{
+    BigInt r = 1;
+    BigInt b = (int64_t)base;
+
+    while (exp) {
+        if (exp & 1) r = r * b;
+        exp >>= 1;
+        if (exp) b = b * b;
+    }
+
+    return r;
+}
+
+
+
+//
+// -- Render the value in decimal
+//    ---------------------------
+std::string BigInt::ToString(void) const
+{
+    if (IsZero()) return "0";
+
+    BigInt t = *this;
+    std::string rv;
+
+    while (!t.IsZero()) {
+        uint32_t chunk = t.DivSmall(1000000000);
+        char buf[16];
+
+        snprintf(buf, sizeof(buf), t.IsZero() ? "%u" : "%09u", chunk);
+        rv.insert(0, buf);
+    }
+
+    if (neg) rv.insert(0, "-");
+    return rv;
+}
+
+
+
+//
+// -- Construct and normalize a Rational
+//    ----------------------------------
+Rational::Rational(const BigInt &n, const BigInt &d) : num(n), den(d)
+{
+    assert(!d.IsZero());
+    Normalize();
+}
+
+
+
+//
+// -- Reduce the fraction to lowest terms with a positive denominator
+//    ---------------------------------------------------------------
+void Rational::Normalize(void)
+{
+    if (den.IsNegative()) {
+        num = -num;
+        den = -den;
+    }
+
+    if (num.IsZero()) {
+        den = 1;
+        return;
+    }
+
+    BigInt g = BigInt::Gcd(num, den);
+
+    if (g != BigInt(1)) {
+        num = num / g;
+        den = den / g;
+    }
+}
+
+
+
+//
+// -- Compare 2 Rationals by cross-multiplying (the denominators are always positive)
+//    -------------------------------------------------------------------------------
+int Rational::Compare(const Rational &a, const Rational &b)
+{
+    return BigInt::Compare(a.num * b.den, b.num * a.den);
+}
+
+
+
+//
+// -- Render the value as `n` or `n/d`
+//    --------------------------------
+std::string Rational::ToString(void) const
+{
+    if (IsInteger()) return num.ToString();
+    return num.ToString() + "/" + den.ToString();
+}
+
+
+
+//
+// -- Decode the text of any numeric literal.  The scanner has already matched the syntax, so this only
+//    has to collect the digits: an optional `base#`, the mantissa (with an optional point), an optional
+//    closing `#` and an optional exponent.  Underscores are ignored everywhere.
+//
+//    The value is mantissa * base ** (exponent - digits after the point), which is always exact.
+//
+//    Note: the scanner accepts any hex digit in a based literal; a digit which is not less than the base
+//    is not diagnosed here.
+//    ----------------------------------------------------------------------------------------------------
+Rational LiteralPool::Decode(const char *text, size_t len)
+{
+    const char *p = text;
+    const char *end = text + len;
+    uint32_t base = 10;
+    bool based = false;
+
+    for (const char *s = p; s < end; s ++) {
+        if (*s == '#') {
+            based = true;
+            break;
+        }
+    }
+
+    if (based) {
+        base = 0;
+        while (*p != '#') {
+            if (*p != '_') base = base * 10 + (*p - '0');
+            p ++;
+        }
+        p ++;
+    }
+
+
+    //
+    // -- collect the mantissa digits, counting those after the point
+    //    ------------------------------------------------------------
+    BigInt mantissa;
+    uint32_t fraction = 0;
+    bool afterPoint = false;
+
+    for ( ; p < end; p ++) {
+        char ch = *p;
+        uint32_t digit;
+
+        if (ch == '_') continue;
+        if (ch == '.') { afterPoint = true; continue; }
+
+        if (ch >= '0' && ch <= '9') digit = ch - '0';
+        else if (ch >= 'a' && ch <= 'f') digit = ch - 'a' + 10;
+        else if (ch >= 'A' && ch <= 'F') digit = ch - 'A' + 10;
+        else break;
+
+        if (!based && digit >= 10) break;           // -- the `e` of a decimal exponent
+
+        mantissa.MulSmall(base);
+        mantissa.AddSmall(digit);
+        if (afterPoint) fraction ++;
+    }
+
+    if (p < end && *p == '#') p ++;
+
+
+    //
+    // -- now the exponent, if there is one
+    //    ---------------------------------
+    int64_t exponent = 0;
+    bool negExp = false;
+
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        p ++;
+        if (*p == '+') p ++;
+        else if (*p == '-') { negExp = true; p ++; }
+
+        for ( ; p < end; p ++) {
+            if (*p == '_') continue;
+            exponent = exponent * 10 + (*p - '0');
+            if (exponent > UINT32_MAX) exponent = UINT32_MAX;
+        }
+    }
+
+    if (negExp) exponent = -exponent;
+    exponent -= fraction;
+
+    if (exponent >= 0) return Rational(mantissa * BigInt::Pow(base, (uint32_t)exponent));
+    return Rational(mantissa, BigInt::Pow(base, (uint32_t)(-exponent)));
+}
+
+
+
+//
+// -- Decode and add an integer literal.  Ada does not allow a negative exponent on an integer literal;
+//    the scanner accepts one anyway, so the value is truncated here and left to the parser to reject.
+//    -------------------------------------------------------------------------------------------------
+uint32_t LiteralPool::AddInteger(const char *text, size_t len)
+{
+    Rational v = Decode(text, len);
+    return AddInteger(v.Numerator() / v.Denominator());
+}
+
+
+
+//
+// -- Decode and add a real literal
+//    -----------------------------
+uint32_t LiteralPool::AddReal(const char *text, size_t len)
+{
+    return AddReal(Decode(text, len));
+}
+
+
+
+//
+// -- Add values which are already decoded
+//    ------------------------------------
+uint32_t LiteralPool::AddInteger(const BigInt &v)
+{
+    std::lock_guard<std::mutex> g(lock);
+    integers.push_back(v);
+    return integers.size() - 1;
+}
+
+
+uint32_t LiteralPool::AddReal(const Rational &v)
+{
+    std::lock_guard<std::mutex> g(lock);
+    reals.push_back(v);
+    return reals.size() - 1;
+}
+
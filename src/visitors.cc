@@ -22,73 +22,73 @@
 //    --------------------------------
 void SymbolPrinter::Visit(const Symbol &s) {
     if (s.kind == Symbol::SymbolKind::Deleted) return;
-    out << "Symbol: " << s.name << " : " << s.KindString() << " (May need a new Visitor)\n";
+    out << "Symbol: " << atoms.Spelling(s.name) << " : " << s.KindString() << " (May need a new Visitor)\n";
 }
 void SymbolPrinter::Visit(const TypeSymbol &s) {
     if (s.kind == Symbol::SymbolKind::Deleted) return;
-    out << "Type: " << s.name << " : " << s.CategoryString() << " (May need a new Visitor)\n";
+    out << "Type: " << atoms.Spelling(s.name) << " : " << s.CategoryString() << " (May need a new Visitor)\n";
 }
 void SymbolPrinter::Visit(const EnumTypeSymbol &s) {
     if (s.kind == Symbol::SymbolKind::Deleted) return;
-    out << "Enumeration Type: " << s.name << " : " << s.CategoryString() << '\n';
+    out << "Enumeration Type: " << atoms.Spelling(s.name) << " : " << s.CategoryString() << '\n';
     out << "   containing literals (";
-    for (auto &sym : s.literals) out << sym->name << ' ';
+    for (auto &sym : s.literals) out << atoms.Spelling(sym->name) << ' ';
     out << "\b)\n";
 }
 void SymbolPrinter::Visit(const RecordTypeSymbol &s) {
     if (s.kind == Symbol::SymbolKind::Deleted) return;
-    out << "Record Type: " << s.name << " : " << s.CategoryString() << '\n';
+    out << "Record Type: " << atoms.Spelling(s.name) << " : " << s.CategoryString() << '\n';
     out << "   containing components (";
-    for (auto &sym : s.components) out << sym->name << ' ';
+    for (auto &sym : s.components) out << atoms.Spelling(sym->name) << ' ';
     out << "\b)\n";
 }
 void SymbolPrinter::Visit(const DerivedTypeSymbol &s) {
     if (s.kind == Symbol::SymbolKind::Deleted) return;
-    out << "Derived Type: " << s.name << " : " << s.CategoryString() << '\n';
+    out << "Derived Type: " << atoms.Spelling(s.name) << " : " << s.CategoryString() << '\n';
 }
 void SymbolPrinter::Visit(const AccessTypeSymbol &s) {
     if (s.kind == Symbol::SymbolKind::Deleted) return;
-    out << "Access Type: " << s.name << " : " << s.CategoryString() << '\n';
+    out << "Access Type: " << atoms.Spelling(s.name) << " : " << s.CategoryString() << '\n';
 }
 void SymbolPrinter::Visit(const IntegerTypeSymbol &s) {
     if (s.kind == Symbol::SymbolKind::Deleted) return;
-    out << "Integer Type: " << s.name << " : " << s.CategoryString() << '\n';
+    out << "Integer Type: " << atoms.Spelling(s.name) << " : " << s.CategoryString() << '\n';
 }
 void SymbolPrinter::Visit(const RealTypeSymbol &s) {
     if (s.kind == Symbol::SymbolKind::Deleted) return;
-    out << "Real Type: " << s.name << " : " << s.CategoryString() << '\n';
+    out << "Real Type: " << atoms.Spelling(s.name) << " : " << s.CategoryString() << '\n';
 }
 void SymbolPrinter::Visit(const ArrayTypeSymbol &s) {
     if (s.kind == Symbol::SymbolKind::Deleted) return;
-    out << "Array Type: " << s.name << " : " << s.CategoryString() << '\n';
+    out << "Array Type: " << atoms.Spelling(s.name) << " : " << s.CategoryString() << '\n';
 }
 void SymbolPrinter::Visit(const SubtypeSymbol &s) {
     if (s.kind == Symbol::SymbolKind::Deleted) return;
-    out << "Subtype: " << s.name << " : " << s.CategoryString() << '\n';
+    out << "Subtype: " << atoms.Spelling(s.name) << " : " << s.CategoryString() << '\n';
 }
 void SymbolPrinter::Visit(const EnumLiteralSymbol &s) {
     if (s.kind == Symbol::SymbolKind::Deleted) return;
-    out << "Enumeration Literal: " << s.name << " : " << s.KindString() << " of type " << s.type->name << "; value (" << s.ordinal << ")\n";
+    out << "Enumeration Literal: " << atoms.Spelling(s.name) << " : " << s.KindString() << " of type " << atoms.Spelling(s.type->name) << "; value (" << s.ordinal << ")\n";
 }
 void SymbolPrinter::Visit(const DiscriminantSymbol &s) {
     if (s.kind == Symbol::SymbolKind::Deleted) return;
-    out << "Discriminant Symbol: " << s.name << " : " << s.KindString() << '\n';
+    out << "Discriminant Symbol: " << atoms.Spelling(s.name) << " : " << s.KindString() << '\n';
 }
 void SymbolPrinter::Visit(const AttributeSymbol &s) {
     if (s.kind == Symbol::SymbolKind::Deleted) return;
-    out << "Attribute Symbol: " << s.name << " : " << s.KindString() << '\n';
+    out << "Attribute Symbol: " << atoms.Spelling(s.name) << " : " << s.KindString() << '\n';
 }
 void SymbolPrinter::Visit(const ObjectSymbol &s) {
     if (s.kind == Symbol::SymbolKind::Deleted) return;
-    out << "Object Symbol: " << s.name << " : " << s.KindString() << '\n';
+    out << "Object Symbol: " << atoms.Spelling(s.name) << " : " << s.KindString() << '\n';
 }
 void SymbolPrinter::Visit(const ComponentSymbol &s) {
     if (s.kind == Symbol::SymbolKind::Deleted) return;
-    out << "Component Symbol: " << s.name << " : " << s.KindString() << '\n';
+    out << "Component Symbol: " << atoms.Spelling(s.name) << " : " << s.KindString() << '\n';
 }
 void SymbolPrinter::Visit(const IncompleteTypeSymbol &s) {
     if (s.kind == Symbol::SymbolKind::Deleted) return;
-    out << "Incomplete Type: " << s.name << " : " << s.CategoryString() << '\n';
+    out << "Incomplete Type: " << atoms.Spelling(s.name) << " : " << s.CategoryString() << '\n';
 }
 
 